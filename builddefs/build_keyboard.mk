@@ -471,6 +471,23 @@ ifneq ($(strip $(INTROSPECTION_KEYMAP_C)),)
 OPT_DEFS += -DINTROSPECTION_KEYMAP_C=\"$(strip $(INTROSPECTION_KEYMAP_C))\"
 endif
 
+# Generate the combo index from the files defining the combos, so that it is rebuilt whenever they change
+ifeq ($(strip $(COMBO_ENABLE)), yes)
+    ifeq ($(strip $(COMBO_INDEX_ENABLE)), yes)
+        COMBO_INDEX_SOURCES := $(KEYMAP_C)
+        ifneq ($(strip $(INTROSPECTION_KEYMAP_C)),)
+            COMBO_INDEX_SOURCES := $(sort $(COMBO_INDEX_SOURCES) $(firstword $(wildcard $(addsuffix /$(strip $(INTROSPECTION_KEYMAP_C)),$(KEYMAP_PATH) $(USER_PATH)))))
+        endif
+
+$(INTERMEDIATE_OUTPUT)/src/combo_index.h: $(COMBO_INDEX_SOURCES)
+	@$(SILENT) || printf "$(MSG_GENERATING) $@" | $(AWK_CMD)
+	$(eval CMD=$(QMK_BIN) generate-combo-index --quiet --output $(INTERMEDIATE_OUTPUT)/src/combo_index.h $(COMBO_INDEX_SOURCES))
+	@$(BUILD_CMD)
+
+generated-files: $(INTERMEDIATE_OUTPUT)/src/combo_index.h
+    endif
+endif
+
 # project specific files
 SRC += \
     $(KEYBOARD_SRC) \
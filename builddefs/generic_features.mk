@@ -49,6 +49,7 @@ GENERIC_FEATURES = \
     SPACE_CADET \
     SWAP_HANDS \
     TAP_DANCE \
+    TASK_PROFILER \
     TRI_LAYER \
     VIA \
     VIRTSER \
@@ -39,6 +39,7 @@ OTHER_OPTION_NAMES = \
   AUTO_SHIFT_ENABLE \
   DYNAMIC_TAPPING_TERM_ENABLE \
   COMBO_ENABLE \
+  COMBO_INDEX_ENABLE \
   KEY_LOCK_ENABLE \
   KEY_OVERRIDE_ENABLE \
   LEADER_ENABLE \
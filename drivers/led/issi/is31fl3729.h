@@ -22,6 +22,7 @@
 #include <stdbool.h>
 #include "progmem.h"
 #include "util.h"
+#include "led_pwm_chunks.h"
 
 #define IS31FL3729_REG_PWM 0x01
 #define IS31FL3729_REG_SCALING 0x90
@@ -78,6 +79,9 @@ void is31fl3729_update_scaling_registers(uint8_t index);
 
 void is31fl3729_flush(void);
 
+// Counts the PWM transfers sent to, and left out for, the chip at `index` since boot
+void is31fl3729_get_pwm_chunk_stats(uint8_t index, led_pwm_chunk_stats_t *stats);
+
 #define IS31FL3729_SW_PULLDOWN_0_OHM 0b000
 #define IS31FL3729_SW_PULLDOWN_0K5_OHM_SW_OFF 0b001
 #define IS31FL3729_SW_PULLDOWN_1K_OHM_SW_OFF 0b010
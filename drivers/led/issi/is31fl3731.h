@@ -21,6 +21,7 @@
 #include <stdbool.h>
 #include "progmem.h"
 #include "util.h"
+#include "led_pwm_chunks.h"
 
 // ======== DEPRECATED DEFINES - DO NOT USE ========
 #ifdef DRIVER_ADDR_1
@@ -124,6 +125,9 @@ void is31fl3731_update_led_control_registers(uint8_t index);
 
 void is31fl3731_flush(void);
 
+// Counts the PWM transfers sent to, and left out for, the chip at `index` since boot
+void is31fl3731_get_pwm_chunk_stats(uint8_t index, led_pwm_chunk_stats_t *stats);
+
 #define C1_1 0x00
 #define C1_2 0x01
 #define C1_3 0x02
@@ -24,6 +24,7 @@
 #include <stdbool.h>
 #include "progmem.h"
 #include "util.h"
+#include "led_pwm_chunks.h"
 
 // ======== DEPRECATED DEFINES - DO NOT USE ========
 #ifdef ISSI_TIMEOUT
@@ -133,6 +134,9 @@ void is31fl3733_update_led_control_registers(uint8_t index);
 
 void is31fl3733_flush(void);
 
+// Counts the PWM transfers sent to, and left out for, the chip at `index` since boot
+void is31fl3733_get_pwm_chunk_stats(uint8_t index, led_pwm_chunk_stats_t *stats);
+
 #define IS31FL3733_PDR_0_OHM 0b000   // No pull-down resistor
 #define IS31FL3733_PDR_0K5_OHM 0b001 // 0.5 kOhm resistor
 #define IS31FL3733_PDR_1K_OHM 0b010  // 1 kOhm resistor
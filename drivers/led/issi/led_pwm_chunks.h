@@ -0,0 +1,59 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Dirty tracking for the PWM buffers of the IS31FL37xx and SNLED27351 drivers.
+
+Each driver sends its PWM buffer in I2C transfers of a fixed size. Rather than a single dirty flag per chip, the
+drivers keep one bit per transfer, set when a register it covers changes, so that a flush only sends the transfers
+that have changed. This is header only, as several keyboards build these drivers without the LED/RGB matrix rules.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "i2c_master.h"
+
+// One bit per I2C transfer of a PWM buffer, buffers can be sent in up to 32 transfers
+typedef uint32_t led_pwm_chunks_t;
+
+typedef struct {
+    uint32_t transfers; // PWM transfers sent
+    uint32_t skipped;   // PWM transfers left out as their registers had not changed
+} led_pwm_chunk_stats_t;
+
+// The transfer that sends register offset `reg`
+#define LED_PWM_CHUNK(reg, chunk_size) ((led_pwm_chunks_t)1 << ((reg) / (chunk_size)))
+
+// Every transfer of a buffer of `count` registers
+#define LED_PWM_CHUNKS_ALL(count, chunk_size) (((led_pwm_chunks_t)1 << (((count) + (chunk_size)-1) / (chunk_size))) - 1)
+
+/**
+ * Sends the transfers of `buffer` flagged in `chunks`.
+ *
+ * @param address The 8-bit I2C address of the chip
+ * @param reg The register that the first byte of the buffer is written to
+ * @param buffer The PWM buffer
+ * @param count The number of registers in the buffer, the last transfer may be shorter than the others
+ * @param chunk_size The number of registers in each transfer
+ * @param chunks The transfers to send
+ * @param timeout The I2C timeout in milliseconds
+ * @param persistence How many times to try each transfer, 0 for once
+ * @param stats Counts the transfers sent and left out
+ */
+static inline void led_pwm_chunks_write(uint8_t address, uint8_t reg, const uint8_t *buffer, uint16_t count, uint8_t chunk_size, led_pwm_chunks_t chunks, uint16_t timeout, uint8_t persistence, led_pwm_chunk_stats_t *stats) {
+    uint8_t attempts = persistence > 0 ? persistence : 1;
+
+    for (uint16_t i = 0; i < count; i += chunk_size) {
+        if (!(chunks & LED_PWM_CHUNK(i, chunk_size))) {
+            stats->skipped++;
+            continue;
+        }
+
+        uint16_t length = count - i < chunk_size ? count - i : chunk_size;
+        for (uint8_t j = 0; j < attempts; j++) {
+            if (i2c_write_register(address, reg + i, buffer + i, length, timeout) == I2C_STATUS_SUCCESS) break;
+        }
+        stats->transfers++;
+    }
+}
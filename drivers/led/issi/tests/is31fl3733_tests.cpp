@@ -0,0 +1,151 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "is31fl3733.h"
+#include "i2c_master.h"
+}
+
+/* The I2C bus is replaced by a model of two chips: each keeps the page selected through the command
+ * register and the PWM registers written to it, and counts the PWM transfers it received. */
+
+static const uint8_t chip_address[IS31FL3733_DRIVER_COUNT] = {0x50, 0x51};
+
+static struct {
+    uint8_t  page;
+    uint8_t  pwm[192];
+    unsigned pwm_transfers;
+    unsigned pwm_bytes;
+} chips[IS31FL3733_DRIVER_COUNT];
+
+extern "C" {
+// Not in the header, sends the whole PWM buffer
+void is31fl3733_write_pwm_buffer(uint8_t index);
+
+// clang-format off
+const is31fl3733_led_t PROGMEM g_is31fl3733_leds[IS31FL3733_LED_COUNT] = {
+    {0, 0x00, 0x01, 0x02}, // all in the first transfer
+    {0, 0x50, 0x51, 0x52}, // all in the sixth transfer
+    {0, 0x1F, 0x20, 0x21}, // across the second and third transfers
+    {1, 0x00, 0x10, 0x20}, // on the second chip
+};
+// clang-format on
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    for (uint8_t i = 0; i < IS31FL3733_DRIVER_COUNT; i++) {
+        if (devaddr != chip_address[i] << 1) continue;
+
+        if (regaddr == IS31FL3733_REG_COMMAND) {
+            chips[i].page = data[0];
+        } else if (chips[i].page == IS31FL3733_COMMAND_PWM && regaddr + length <= sizeof(chips[i].pwm)) {
+            memcpy(&chips[i].pwm[regaddr], data, length);
+            // Single register writes are the driver clearing the chip in is31fl3733_init()
+            if (length > 1) {
+                chips[i].pwm_transfers++;
+                chips[i].pwm_bytes += length;
+            }
+        }
+        return I2C_STATUS_SUCCESS;
+    }
+    return I2C_STATUS_ERROR;
+}
+}
+
+class IS31FL3733PwmChunks : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        is31fl3733_init_drivers();
+        is31fl3733_set_color_all(0, 0, 0);
+        is31fl3733_flush();
+        clear_counts();
+    }
+
+    void clear_counts() {
+        for (auto &chip : chips) {
+            chip.pwm_transfers = 0;
+            chip.pwm_bytes     = 0;
+        }
+    }
+
+    led_pwm_chunk_stats_t stats(uint8_t index) {
+        led_pwm_chunk_stats_t stats;
+        is31fl3733_get_pwm_chunk_stats(index, &stats);
+        return stats;
+    }
+};
+
+TEST_F(IS31FL3733PwmChunks, UnchangedBufferSendsNothing) {
+    is31fl3733_set_color(0, 0, 0, 0);
+    is31fl3733_flush();
+    EXPECT_EQ(chips[0].pwm_transfers, 0u);
+    EXPECT_EQ(chips[1].pwm_transfers, 0u);
+}
+
+TEST_F(IS31FL3733PwmChunks, OnlyChangedTransfersAreSent) {
+    is31fl3733_set_color(0, 1, 2, 3);
+    is31fl3733_flush();
+    EXPECT_EQ(chips[0].pwm_transfers, 1u);
+    EXPECT_EQ(chips[0].pwm_bytes, 16u);
+    EXPECT_EQ(chips[1].pwm_transfers, 0u);
+    EXPECT_EQ(chips[0].pwm[0x00], 1);
+    EXPECT_EQ(chips[0].pwm[0x01], 2);
+    EXPECT_EQ(chips[0].pwm[0x02], 3);
+
+    clear_counts();
+    is31fl3733_set_color(2, 4, 5, 6);
+    is31fl3733_flush();
+    EXPECT_EQ(chips[0].pwm_transfers, 2u);
+    EXPECT_EQ(chips[0].pwm[0x1F], 4);
+    EXPECT_EQ(chips[0].pwm[0x20], 5);
+    EXPECT_EQ(chips[0].pwm[0x21], 6);
+}
+
+TEST_F(IS31FL3733PwmChunks, FullFrameSendsEveryTransfer) {
+    is31fl3733_set_color_all(7, 8, 9);
+    is31fl3733_flush();
+    // Every LED here lives in 4 transfers of the first chip and 3 of the second
+    EXPECT_EQ(chips[0].pwm_transfers, 4u);
+    EXPECT_EQ(chips[1].pwm_transfers, 3u);
+
+    clear_counts();
+    for (uint8_t i = 0; i < IS31FL3733_DRIVER_COUNT; i++) {
+        is31fl3733_write_pwm_buffer(i);
+    }
+    EXPECT_EQ(chips[0].pwm_transfers, 12u);
+    EXPECT_EQ(chips[0].pwm_bytes, 192u);
+}
+
+TEST_F(IS31FL3733PwmChunks, PanelMatchesBufferAfterFlush) {
+    uint8_t expected[IS31FL3733_DRIVER_COUNT][192] = {};
+    for (uint8_t frame = 1; frame < 20; frame++) {
+        for (uint8_t led = 0; led < IS31FL3733_LED_COUNT; led++) {
+            if ((frame + led) % 3 == 0) continue;
+            is31fl3733_led_t map = g_is31fl3733_leds[led];
+            uint8_t          r = frame * 3 + led, g = frame * 5 + led, b = frame * 7 + led;
+            is31fl3733_set_color(led, r, g, b);
+            expected[map.driver][map.r] = r;
+            expected[map.driver][map.g] = g;
+            expected[map.driver][map.b] = b;
+        }
+        is31fl3733_flush();
+        for (uint8_t i = 0; i < IS31FL3733_DRIVER_COUNT; i++) {
+            EXPECT_EQ(memcmp(chips[i].pwm, expected[i], sizeof(expected[i])), 0) << "chip " << (int)i << " frame " << (int)frame;
+        }
+    }
+}
+
+TEST_F(IS31FL3733PwmChunks, StatsAreKeptPerChip) {
+    led_pwm_chunk_stats_t before_0 = stats(0), before_1 = stats(1);
+
+    is31fl3733_set_color(3, 1, 1, 1);
+    is31fl3733_flush();
+
+    EXPECT_EQ(stats(0).transfers, before_0.transfers);
+    EXPECT_EQ(stats(1).transfers, before_1.transfers + 3);
+    EXPECT_EQ(stats(1).skipped, before_1.skipped + 9);
+}
@@ -0,0 +1,7 @@
+is31fl3733_pwm_chunks_DEFS := -DNO_DEBUG -DIS31FL3733_I2C_ADDRESS_1=0x50 -DIS31FL3733_I2C_ADDRESS_2=0x51 -DIS31FL3733_LED_COUNT=4
+is31fl3733_pwm_chunks_INC := $(DRIVER_PATH)/led/issi/tests $(DRIVER_PATH)/led/issi
+
+is31fl3733_pwm_chunks_SRC := \
+	$(DRIVER_PATH)/led/issi/tests/is31fl3733_tests.cpp \
+	$(DRIVER_PATH)/led/issi/is31fl3733.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
@@ -20,6 +20,7 @@
 #include <stdbool.h>
 #include "progmem.h"
 #include "util.h"
+#include "issi/led_pwm_chunks.h"
 
 // ======== DEPRECATED DEFINES - DO NOT USE ========
 #ifdef DRIVER_ADDR_1
@@ -186,6 +187,9 @@ void snled27351_update_led_control_registers(uint8_t index);
 
 void snled27351_flush(void);
 
+// Counts the PWM transfers sent to, and left out for, the chip at `index` since boot
+void snled27351_get_pwm_chunk_stats(uint8_t index, led_pwm_chunk_stats_t *stats);
+
 void snled27351_sw_return_normal(uint8_t index);
 void snled27351_sw_shutdown(uint8_t index);
 
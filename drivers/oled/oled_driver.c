@@ -159,6 +159,12 @@ uint8_t         oled_scroll_end     = 7;
 #if OLED_TIMEOUT > 0
 uint32_t oled_timeout;
 #endif
+#ifdef OLED_SHADOW_BUFFER
+// What the panel currently shows, as last sent from oled_buffer, so that only the bytes that changed are sent
+static uint8_t oled_shadow[OLED_MATRIX_SIZE];
+// Blocks where the panel may not match oled_shadow, after init, scrolling or a failed transfer
+static OLED_BLOCK_TYPE oled_shadow_stale = OLED_ALL_BLOCKS_MASK;
+#endif
 #if OLED_SCROLL_TIMEOUT > 0
 uint32_t oled_scroll_timeout;
 #endif
@@ -363,6 +369,9 @@ bool oled_init(oled_rotation_t rotation) {
 #endif
 
     oled_clear();
+#ifdef OLED_SHADOW_BUFFER
+    oled_shadow_stale = OLED_ALL_BLOCKS_MASK;
+#endif
     oled_initialized = true;
     oled_active      = true;
     oled_scrolling   = false;
@@ -431,6 +440,34 @@ static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
 #endif
 }
 
+#ifdef OLED_SHADOW_BUFFER
+static void calc_span_bounds(uint16_t index, uint16_t length, uint8_t *cmd_array) {
+    // Calculate commands to set memory addressing bounds for a span of bytes within a page.
+    uint8_t start_page   = index / OLED_DISPLAY_WIDTH;
+    uint8_t start_column = index % OLED_DISPLAY_WIDTH;
+#    if !OLED_IC_HAS_HORIZONTAL_MODE
+    cmd_array[0] = PAM_PAGE_ADDR | start_page;
+    cmd_array[1] = PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + start_column) & 0x0f);
+    cmd_array[2] = PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + start_column) >> 4 & 0x0f);
+#    else
+    cmd_array[1] = start_column + OLED_COLUMN_OFFSET;
+    cmd_array[4] = start_page;
+    cmd_array[2] = length - 1 + cmd_array[1];
+    cmd_array[5] = start_page;
+#    endif
+}
+
+// Clears the dirty flag of blocks that were written with what the panel already shows
+static void oled_drop_unchanged_blocks(void) {
+    OLED_BLOCK_TYPE candidates = oled_dirty & ~oled_shadow_stale & OLED_ALL_BLOCKS_MASK;
+    for (uint8_t i = 0; candidates; ++i, candidates >>= 1) {
+        if ((candidates & 1) && !memcmp(&oled_buffer[OLED_BLOCK_SIZE * i], &oled_shadow[OLED_BLOCK_SIZE * i], OLED_BLOCK_SIZE)) {
+            oled_dirty &= ~((OLED_BLOCK_TYPE)1 << i);
+        }
+    }
+}
+#endif
+
 uint8_t crot(uint8_t a, int8_t n) {
     const uint8_t mask = 0x7;
     n &= mask;
@@ -449,6 +486,9 @@ static void rotate_90(const uint8_t *src, uint8_t *dest) {
 void oled_render_dirty(bool all) {
     // Do we have work to do?
     oled_dirty &= OLED_ALL_BLOCKS_MASK;
+#ifdef OLED_SHADOW_BUFFER
+    oled_drop_unchanged_blocks();
+#endif
     if (!oled_dirty || !oled_initialized || oled_scrolling) {
         return;
     }
@@ -469,6 +509,46 @@ void oled_render_dirty(bool all) {
         static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
 #else
         static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
+#endif
+#ifdef OLED_SHADOW_BUFFER
+        if (OLED_BLOCK_SIZE <= OLED_DISPLAY_WIDTH && !HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+            // Join the following dirty blocks on the same page into a single transfer
+            OLED_BLOCK_TYPE run   = (OLED_BLOCK_TYPE)1 << update_start;
+            uint16_t        start = OLED_BLOCK_SIZE * update_start;
+            uint16_t        end   = start + OLED_BLOCK_SIZE;
+            while (end < OLED_MATRIX_SIZE && end / OLED_DISPLAY_WIDTH == start / OLED_DISPLAY_WIDTH && (oled_dirty & ((OLED_BLOCK_TYPE)1 << (update_start + 1))) && (num_processed < OLED_UPDATE_PROCESS_LIMIT || all)) {
+                ++update_start;
+                ++num_processed;
+                run |= (OLED_BLOCK_TYPE)1 << update_start;
+                end += OLED_BLOCK_SIZE;
+            }
+
+            // Only send from the first to the last byte that differs from the panel
+            if (!(oled_shadow_stale & run)) {
+                while (oled_buffer[start] == oled_shadow[start]) {
+                    ++start;
+                }
+                while (oled_buffer[end - 1] == oled_shadow[end - 1]) {
+                    --end;
+                }
+            }
+
+            calc_span_bounds(start, end - start, &display_start[1]); // Offset from I2C_CMD byte at the start
+            if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+                print("oled_render offset command failed\n");
+                return;
+            }
+
+            oled_shadow_stale |= run;
+            if (!oled_send_data(&oled_buffer[start], end - start)) {
+                print("oled_render data failed\n");
+                return;
+            }
+            memcpy(&oled_shadow[start], &oled_buffer[start], end - start);
+            oled_shadow_stale &= ~run;
+            oled_dirty &= ~run;
+            continue;
+        }
 #endif
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
             calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
@@ -482,6 +562,10 @@ void oled_render_dirty(bool all) {
             return;
         }
 
+#ifdef OLED_SHADOW_BUFFER
+        oled_shadow_stale |= (OLED_BLOCK_TYPE)1 << update_start;
+#endif
+
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
             // Send render data chunk as is
             if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
@@ -527,6 +611,11 @@ void oled_render_dirty(bool all) {
 #endif
         }
 
+#ifdef OLED_SHADOW_BUFFER
+        memcpy(&oled_shadow[OLED_BLOCK_SIZE * update_start], &oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE);
+        oled_shadow_stale &= ~((OLED_BLOCK_TYPE)1 << update_start);
+#endif
+
         // Clear dirty flag of just rendered block
         oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
     }
@@ -878,6 +967,10 @@ bool oled_scroll_off(void) {
         }
         oled_scrolling = false;
         oled_dirty     = OLED_ALL_BLOCKS_MASK;
+#ifdef OLED_SHADOW_BUFFER
+        // Scrolling has moved the contents of the panel's memory
+        oled_shadow_stale = OLED_ALL_BLOCKS_MASK;
+#endif
     }
     return !oled_scrolling;
 }
@@ -941,6 +1034,10 @@ void oled_task(void) {
 #endif
 
 #if OLED_SCROLL_TIMEOUT > 0
+#    ifdef OLED_SHADOW_BUFFER
+    // Redrawing what was shown before scrolling started is not a change
+    oled_drop_unchanged_blocks();
+#    endif
     if (oled_dirty && oled_scrolling) {
         oled_scroll_timeout = timer_read32() + OLED_SCROLL_TIMEOUT;
         oled_scroll_off();
@@ -0,0 +1,162 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "oled_driver.h"
+#include "i2c_master.h"
+}
+
+/* The I2C bus is replaced by a model of the panel memory. Address commands move the write position
+ * as on the chip, using the column and page window of the SSD1306 horizontal addressing mode, or the
+ * page addressing mode of the SH1106, and every data byte lands in panel[]. */
+
+#define CMD_COLUMN_ADDR 0x21
+#define CMD_PAGE_ADDR 0x22
+#define CMD_PAM_PAGE_ADDR 0xB0
+
+static uint8_t  panel[OLED_MATRIX_SIZE];
+static uint8_t  page, column, first_page, last_page, first_column, last_column;
+static unsigned data_bytes;
+static bool     fail_next_data;
+
+extern "C" {
+// Not in the header, what the driver last drew
+extern uint8_t oled_buffer[OLED_MATRIX_SIZE];
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    // data[0] is the command control byte
+    if (length == 7 && data[1] == CMD_COLUMN_ADDR && data[4] == CMD_PAGE_ADDR) {
+        first_column = column = data[2] - OLED_COLUMN_OFFSET;
+        last_column           = data[3] - OLED_COLUMN_OFFSET;
+        first_page = page = data[5];
+        last_page         = data[6];
+    } else if (length == 4 && (data[1] & 0xF0) == CMD_PAM_PAGE_ADDR) {
+        page   = data[1] & 0x0F;
+        column = ((data[2] & 0x0F) | (data[3] & 0x0F) << 4) - OLED_COLUMN_OFFSET;
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_transmit_P(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    return i2c_transmit(address, data, length, timeout);
+}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    if (fail_next_data) {
+        fail_next_data = false;
+        return I2C_STATUS_ERROR;
+    }
+    data_bytes += length;
+    for (uint16_t i = 0; i < length; i++) {
+        EXPECT_LT(page * OLED_DISPLAY_WIDTH + column, OLED_MATRIX_SIZE);
+        panel[page * OLED_DISPLAY_WIDTH + column] = data[i];
+#if OLED_IC == OLED_IC_SSD1306
+        if (column++ == last_column) {
+            column = first_column;
+            page   = page == last_page ? first_page : page + 1;
+        }
+#else
+        column++;
+#endif
+    }
+    return I2C_STATUS_SUCCESS;
+}
+}
+
+class OledPanel : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // Whatever the panel showed before the keyboard started
+        memset(panel, 0xA5, sizeof(panel));
+        fail_next_data = false;
+        ASSERT_TRUE(oled_init(OLED_ROTATION_0));
+        oled_render_dirty(true);
+        data_bytes = 0;
+    }
+
+    void expect_panel_matches_buffer() {
+        for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i++) {
+            ASSERT_EQ(panel[i], oled_buffer[i]) << "byte " << i;
+        }
+    }
+
+    // A status screen as keymaps tend to draw it, starting from a cleared buffer every time
+    void draw_status(unsigned wpm) {
+        char line[22];
+        oled_clear();
+        oled_write_ln("Layer: Base", false);
+        snprintf(line, sizeof(line), "WPM: %03u", wpm % 1000);
+        oled_write_ln(line, false);
+        oled_write_ln("CAPS", true);
+    }
+};
+
+TEST_F(OledPanel, InitSendsTheWholeBuffer) {
+    ASSERT_TRUE(oled_init(OLED_ROTATION_0));
+    oled_render_dirty(true);
+    EXPECT_EQ(data_bytes, (unsigned)OLED_MATRIX_SIZE);
+    expect_panel_matches_buffer();
+}
+
+TEST_F(OledPanel, PanelMatchesBufferAfterRandomWrites) {
+    srand(1);
+    for (int i = 0; i < 2000; i++) {
+        switch (rand() % 5) {
+            case 0:
+                oled_clear();
+                break;
+            case 1:
+                oled_set_cursor(rand() % oled_max_chars(), rand() % oled_max_lines());
+                oled_write("QMK", rand() % 2);
+                break;
+            case 2:
+                oled_write_raw_byte(rand(), rand() % OLED_MATRIX_SIZE);
+                break;
+            case 3:
+                oled_write_pixel(rand() % OLED_DISPLAY_WIDTH, rand() % OLED_DISPLAY_HEIGHT, rand() % 2);
+                break;
+            case 4:
+                // The driver has to resend what didn't get through
+                fail_next_data = true;
+                break;
+        }
+        oled_render_dirty(rand() % 2);
+        if (i % 10 == 9) {
+            fail_next_data = false;
+            oled_render_dirty(true);
+            expect_panel_matches_buffer();
+        }
+    }
+}
+
+TEST_F(OledPanel, ClearAndRedrawTraffic) {
+    draw_status(0);
+    oled_render_dirty(true);
+    expect_panel_matches_buffer();
+
+    for (unsigned wpm = 1; wpm < 3000; wpm++) {
+        data_bytes = 0;
+        draw_status(wpm / 10);
+        oled_render_dirty(true);
+#ifdef OLED_SHADOW_BUFFER
+        if (wpm % 10) {
+            // Nothing on screen changed
+            EXPECT_EQ(data_bytes, 0u);
+        } else {
+            // At most the three digits, which are next to each other
+            EXPECT_GT(data_bytes, 0u);
+            EXPECT_LE(data_bytes, 3u * OLED_FONT_WIDTH);
+        }
+#else
+        EXPECT_EQ(data_bytes, (unsigned)OLED_MATRIX_SIZE);
+#endif
+    }
+    expect_panel_matches_buffer();
+}
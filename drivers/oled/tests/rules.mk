@@ -0,0 +1,15 @@
+oled_ssd1306_DEFS := -DNO_DEBUG -DNO_PRINT -DOLED_TRANSPORT_I2C -DOLED_DISABLE_TIMEOUT
+oled_ssd1306_INC := $(DRIVER_PATH)/oled/tests $(DRIVER_PATH)/oled
+
+oled_ssd1306_SRC := \
+	$(DRIVER_PATH)/oled/tests/oled_panel_tests.cpp \
+	$(DRIVER_PATH)/oled/oled_driver.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+oled_shadow_ssd1306_DEFS := $(oled_ssd1306_DEFS) -DOLED_SHADOW_BUFFER
+oled_shadow_ssd1306_INC := $(oled_ssd1306_INC)
+oled_shadow_ssd1306_SRC := $(oled_ssd1306_SRC)
+
+oled_shadow_sh1106_DEFS := $(oled_ssd1306_DEFS) -DOLED_SHADOW_BUFFER -DOLED_IC=OLED_IC_SH1106
+oled_shadow_sh1106_INC := $(oled_ssd1306_INC)
+oled_shadow_sh1106_SRC := $(oled_ssd1306_SRC)
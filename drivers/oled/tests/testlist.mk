@@ -0,0 +1,4 @@
+TEST_LIST += \
+	oled_ssd1306 \
+	oled_shadow_ssd1306 \
+	oled_shadow_sh1106
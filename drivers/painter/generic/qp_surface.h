@@ -21,6 +21,14 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_ASYNC_BUFFER_SIZE
+/**
+ * @def This controls the size of each of the two buffers used to stage pixel data when a surface is drawn asynchronously.
+ *      Only regions narrower than the surface are staged, whole rows are sent straight from the framebuffer.
+ */
+#    define SURFACE_ASYNC_BUFFER_SIZE 1024
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -64,4 +72,41 @@ painter_device_t qp_make_mono1bpp_surface(uint16_t panel_width, uint16_t panel_h
  */
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
 
+/**
+ * Callback invoked once an asynchronous draw of a surface has completed.
+ *
+ * @param surface[in] the surface that was drawn
+ * @param target[in] the target device it was drawn to
+ * @param success[in] whether all of the pixel data was transferred
+ * @param cb_arg[in] the argument supplied to qp_surface_draw_async
+ */
+typedef void (*qp_surface_draw_callback_t)(painter_device_t surface, painter_device_t target, bool success, void *cb_arg);
+
+/**
+ * Helper method to draw the contents of the framebuffer to the target device, without waiting for the transfer.
+ *
+ * The pixel data is streamed to the target in chunks from the Quantum Painter task, using DMA where the target's comms
+ * support it. Drawing to the surface before the callback has been invoked waits for the transfer to complete. Nothing
+ * else should be drawn to the target until then. Only one asynchronous draw is in progress at a time, starting another
+ * one waits for the previous one to complete. Surfaces other than RGB565 are drawn before returning.
+ *
+ * @param surface[in] the surface to copy from
+ * @param target[in] the target device to copy into
+ * @param x[in] the x-location of the original position of the framebuffer
+ * @param y[in] the y-location of the original position of the framebuffer
+ * @param entire_surface[in] whether the entire surface should be drawn, instead of just the dirty region
+ * @param callback[in] the function to invoke once the draw has completed, may be NULL
+ * @param cb_arg[in] the argument to supply to the callback
+ * @return whether the draw operation was started successfully
+ */
+bool qp_surface_draw_async(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface, qp_surface_draw_callback_t callback, void *cb_arg);
+
+/**
+ * Checks whether an asynchronous draw of the surface is still in progress.
+ *
+ * @param surface[in] the surface to check
+ * @return whether the surface is still being drawn
+ */
+bool qp_surface_draw_in_progress(painter_device_t surface);
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "color.h"
+#include "qp_comms.h"
 #include "qp_draw.h"
 #include "qp_surface_internal.h"
 
@@ -49,12 +50,18 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
     }
 }
 
+static void qp_surface_async_wait_for(painter_device_t surface);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Driver vtable
 
 bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     painter_driver_t *        driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
+
+    // The framebuffer may still be being read by an asynchronous draw
+    qp_surface_async_wait_for(device);
+
     memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
 
     surface->dirty.l        = 0;
@@ -90,6 +97,10 @@ bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, u
     painter_driver_t *        driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
 
+    // Every write to the framebuffer starts with setting the viewport, so let any asynchronous draw of it complete
+    // first -- the target must never be sent a mix of the old and new contents
+    qp_surface_async_wait_for(device);
+
     // Set the viewport locations
     surface->viewport.viewport_l = left;
     surface->viewport.viewport_t = top;
@@ -105,11 +116,16 @@ bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, u
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Drawing routine to copy out the dirty region and send it to another device
 
+static void qp_surface_async_wait(void);
+
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface) {
     painter_driver_t *        surface_driver = (painter_driver_t *)surface;
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
     painter_driver_t *        target_driver  = (painter_driver_t *)target;
 
+    // Let any asynchronous draw complete first, so the two don't interleave on the target
+    qp_surface_async_wait();
+
     // If we're not dirty... we're done.
     if (!surface_handle->dirty.is_dirty) {
         qp_dprintf("qp_surface_draw: ok (not dirty, skipping)\n");
@@ -139,3 +155,187 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
     qp_dprintf("qp_surface_draw: ok\n");
     return true;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Asynchronous drawing routine, streaming the dirty region to another device from the Quantum Painter task
+
+typedef struct surface_async_state_t {
+    painter_device_t           surface; // NULL when no draw is in progress
+    painter_device_t           target;
+    qp_surface_draw_callback_t callback;
+    void *                     cb_arg;
+    surface_transfer_data_t    transfer;
+
+    // Whether a chunk has been handed to the target and may still be being sent
+    bool sending;
+
+    // The chunk to hand to the target next, prepared while the previous one is being sent
+    const void *next_data;
+    uint32_t    next_pixel_count;
+    uint8_t     next_buffer;
+} surface_async_state_t;
+
+static surface_async_state_t surface_async;
+
+// Chunks are staged alternately in each buffer, so one can be filled while the other is being sent
+static uint8_t surface_async_buffers[2][SURFACE_ASYNC_BUFFER_SIZE] __attribute__((aligned(4)));
+
+static void qp_surface_async_prepare(void) {
+    surface_transfer_data_t *transfer = &surface_async.transfer;
+    if (surface_async.next_pixel_count > 0 || transfer->y > transfer->b) {
+        return;
+    }
+
+    painter_driver_t *               surface_driver = (painter_driver_t *)surface_async.surface;
+    surface_painter_driver_vtable_t *vtable         = (surface_painter_driver_vtable_t *)surface_driver->driver_vtable;
+    uint8_t *                        buffer         = surface_async_buffers[surface_async.next_buffer];
+    surface_async.next_data                         = vtable->target_pixdata_chunk(surface_driver, transfer, buffer, sizeof(surface_async_buffers[0]), &surface_async.next_pixel_count);
+    if (surface_async.next_data == buffer) {
+        surface_async.next_buffer ^= 1;
+    }
+}
+
+static void qp_surface_async_complete(bool success) {
+    surface_async_state_t completed = surface_async;
+    surface_async.surface           = NULL;
+    qp_dprintf("qp_surface_draw_async: %s\n", success ? "ok" : "fail (could not stream pixdata to target)");
+    if (completed.callback) {
+        completed.callback(completed.surface, completed.target, success, completed.cb_arg);
+    }
+}
+
+static void qp_surface_async_step(void) {
+    if (!surface_async.surface) {
+        return;
+    }
+
+    painter_device_t  target        = surface_async.target;
+    painter_driver_t *target_driver = (painter_driver_t *)target;
+
+    // Wait for the chunk being sent to complete
+    if (surface_async.sending) {
+        if (qp_comms_busy(target)) {
+            return;
+        }
+        qp_comms_stop(target);
+        surface_async.sending = false;
+    }
+
+    if (surface_async.next_pixel_count == 0) {
+        qp_surface_async_complete(true);
+        return;
+    }
+
+    // Hand over the prepared chunk, falling back to a blocking send if the target can't stream asynchronously
+    if (!qp_comms_start(target)) {
+        qp_surface_async_complete(false);
+        return;
+    }
+    painter_driver_pixdata_func pixdata = target_driver->driver_vtable->pixdata_async ? target_driver->driver_vtable->pixdata_async : target_driver->driver_vtable->pixdata;
+    if (!pixdata(target, surface_async.next_data, surface_async.next_pixel_count)) {
+        qp_comms_stop(target);
+        qp_surface_async_complete(false);
+        return;
+    }
+    surface_async.next_pixel_count = 0;
+
+    // Release the bus straight away if the chunk has already been sent, otherwise once it has completed
+    if (qp_comms_busy(target)) {
+        surface_async.sending = true;
+    } else {
+        qp_comms_stop(target);
+    }
+
+    // Stage the next chunk while this one is on its way
+    qp_surface_async_prepare();
+}
+
+static void qp_surface_async_wait(void) {
+    while (surface_async.surface) {
+        qp_surface_async_step();
+    }
+}
+
+static void qp_surface_async_wait_for(painter_device_t surface) {
+    while (surface_async.surface == surface) {
+        qp_surface_async_step();
+    }
+}
+
+void qp_surface_async_task(void) {
+    qp_surface_async_step();
+}
+
+bool qp_surface_draw_async(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface, qp_surface_draw_callback_t callback, void *cb_arg) {
+    painter_driver_t *               surface_driver = (painter_driver_t *)surface;
+    surface_painter_device_t *       surface_handle = (surface_painter_device_t *)surface_driver;
+    painter_driver_t *               target_driver  = (painter_driver_t *)target;
+    surface_painter_driver_vtable_t *vtable         = (surface_painter_driver_vtable_t *)surface_driver->driver_vtable;
+
+    // Only one asynchronous draw is in progress at a time
+    qp_surface_async_wait();
+
+    // If we're not dirty... we're done.
+    if (!surface_handle->dirty.is_dirty) {
+        qp_dprintf("qp_surface_draw_async: ok (not dirty, skipping)\n");
+        if (callback) {
+            callback(surface, target, true, cb_arg);
+        }
+        return true;
+    }
+
+    // If we have incompatible bit depths, drop out
+    if (surface_driver->native_bits_per_pixel != target_driver->native_bits_per_pixel) {
+        qp_dprintf("qp_surface_draw_async: fail (incompatible bpp: surface=%d, target=%d)\n", (int)surface_driver->native_bits_per_pixel, (int)target_driver->native_bits_per_pixel);
+        return false;
+    }
+
+    // Surfaces that can't hand out their pixel data in chunks are drawn before returning
+    if (!vtable->target_pixdata_chunk) {
+        if (!qp_surface_draw(surface, target, x, y, entire_surface)) {
+            return false;
+        }
+        if (callback) {
+            callback(surface, target, true, cb_arg);
+        }
+        return true;
+    }
+
+    surface_transfer_data_t transfer = {
+        .l = entire_surface ? 0 : surface_handle->dirty.l,
+        .t = entire_surface ? 0 : surface_handle->dirty.t,
+        .r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r,
+        .b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b,
+    };
+    transfer.x = transfer.l;
+    transfer.y = transfer.t;
+
+    // Set the target drawing area
+    if (!qp_viewport(target, x + transfer.l, y + transfer.t, x + transfer.r, y + transfer.b)) {
+        qp_dprintf("qp_surface_draw_async: fail (could not set target viewport)\n");
+        return false;
+    }
+
+    // Clear the dirty info up front, anything drawn afterwards waits for the transfer and is sent by the next draw
+    if (!qp_flush(surface)) {
+        qp_dprintf("qp_surface_draw_async: fail (could not flush)\n");
+        return false;
+    }
+
+    surface_async = (surface_async_state_t){
+        .surface  = surface,
+        .target   = target,
+        .callback = callback,
+        .cb_arg   = cb_arg,
+        .transfer = transfer,
+    };
+
+    // Stage the first chunk and start sending it, the rest follow from the Quantum Painter task
+    qp_surface_async_prepare();
+    qp_surface_async_step();
+    return true;
+}
+
+bool qp_surface_draw_in_progress(painter_device_t surface) {
+    return surface_async.surface != NULL && surface_async.surface == surface;
+}
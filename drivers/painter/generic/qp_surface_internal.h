@@ -9,11 +9,27 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Internal declarations
 
+// Progress of an asynchronous transfer of a region of the surface to a target device
+typedef struct surface_transfer_data_t {
+    // The region being transferred
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+
+    // The next pixel of the region to be handed to the target
+    uint16_t x;
+    uint16_t y;
+} surface_transfer_data_t;
+
 // Surface vtable
 typedef struct surface_painter_driver_vtable_t {
     painter_driver_vtable_t base; // must be first, so it can be cast to/from the painter_driver_vtable_t* type
 
     bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface);
+
+    // Optional, returns the next run of native pixels of the transfer, either straight from the framebuffer or copied into `buffer`
+    const void *(*target_pixdata_chunk)(painter_driver_t *surface_driver, surface_transfer_data_t *transfer, uint8_t *buffer, uint32_t buffer_size, uint32_t *pixel_count);
 } surface_painter_driver_vtable_t;
 
 typedef struct surface_dirty_data_t {
@@ -90,6 +106,9 @@ bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, u
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
 
+// Moves an asynchronous draw along, called from the Quantum Painter task
+void qp_surface_async_task(void);
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
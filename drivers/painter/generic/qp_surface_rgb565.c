@@ -119,6 +119,40 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     return true;
 }
 
+static const void *rgb565_target_pixdata_chunk(painter_driver_t *surface_driver, surface_transfer_data_t *transfer, uint8_t *buffer, uint32_t buffer_size, uint32_t *pixel_count) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+    uint16_t                  width          = surface_handle->base.panel_width;
+
+    // Whole rows are contiguous in the framebuffer, so as many as fit in a single transfer are sent without copying
+    if (transfer->l == 0 && transfer->r == width - 1) {
+        uint32_t rows = QP_MIN((uint32_t)(transfer->b - transfer->y + 1), (UINT16_MAX / sizeof(uint16_t)) / width);
+        if (rows > 0) {
+            const uint16_t *source = &surface_handle->u16buffer[transfer->y * width];
+            transfer->y += rows;
+            *pixel_count = rows * width;
+            return source;
+        }
+    }
+
+    // Otherwise copy out as much of the region as fits in the buffer, a row segment at a time
+    uint16_t *target_buffer = (uint16_t *)buffer;
+    uint32_t  max_pixels    = buffer_size / sizeof(uint16_t);
+    uint32_t  count         = 0;
+    while (count < max_pixels && transfer->y <= transfer->b) {
+        uint32_t segment = QP_MIN((uint32_t)(transfer->r - transfer->x + 1), max_pixels - count);
+        memcpy(&target_buffer[count], &surface_handle->u16buffer[transfer->y * width + transfer->x], segment * sizeof(uint16_t));
+        count += segment;
+        transfer->x += segment;
+        if (transfer->x > transfer->r) {
+            transfer->x = transfer->l;
+            transfer->y++;
+        }
+    }
+
+    *pixel_count = count;
+    return buffer;
+}
+
 static bool qp_surface_append_pixdata_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
     target_buffer[pixdata_offset] = pixdata_byte;
     return true;
@@ -138,6 +172,7 @@ const surface_painter_driver_vtable_t rgb565_surface_driver_vtable = {
             .append_pixdata  = qp_surface_append_pixdata_rgb565,
         },
     .target_pixdata_transfer = rgb565_target_pixdata_transfer,
+    .target_pixdata_chunk    = rgb565_target_pixdata_chunk,
 };
 
 SURFACE_FACTORY_FUNCTION_IMPL(qp_make_rgb565_surface, rgb565_surface_driver_vtable, 16);
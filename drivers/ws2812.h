@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include "quantum/color.h"
 
 /*
@@ -74,5 +75,13 @@ void ws2812_init(void);
  *         - Set the data-out pin as output
  *         - Send out the LED data
  *         - Wait 50us to reset the LEDs
+ *
+ * DMA based drivers (SPI, PWM and PIO) copy the data and return while the frame is still being sent, so that the
+ * next frame can be rendered straight away.
  */
 void ws2812_setleds(rgb_led_t *ledarray, uint16_t number_of_leds);
+
+/* Returns true until the last frame passed to ws2812_setleds() has been sent out and latched by the LEDs. Drivers that
+ * send the frame before ws2812_setleds() returns always report false.
+ */
+bool ws2812_busy(void);
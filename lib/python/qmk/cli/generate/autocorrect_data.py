@@ -28,7 +28,7 @@ For full documentation, see QMK Docs
 """
 
 import textwrap
-from typing import Any, Dict, Iterator, List, Tuple
+from typing import Any, Dict, Iterator, List, Optional, Tuple
 
 from milc import cli
 
@@ -80,6 +80,8 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
 
     autocorrections = []
     typos = set()
+    # Every substring of the typos accepted so far, mapped to a typo containing it
+    typo_substrings = {}
     for line_number, typo, correction in parse_file_lines(file_name):
         if typo in typos:
             cli.log.warning('{fg_red}Error:%d:{fg_reset} Ignoring duplicate typo: "{fg_cyan}%s{fg_reset}"', line_number, typo)
@@ -89,22 +91,31 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
         if not (all([c in TYPO_CHARS for c in typo])):
             cli.log.error('{fg_red}Error:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" has characters other than a-z, \' and :.', line_number, typo)
             maybe_exit(1)
-        for other_typo in typos:
-            if typo in other_typo or other_typo in typo:
-                cli.log.error('{fg_red}Error:%d:{fg_reset} Typos may not be substrings of one another, otherwise the longer typo would never trigger: "{fg_cyan}%s{fg_reset}" vs. "{fg_cyan}%s{fg_reset}".', line_number, typo, other_typo)
-                maybe_exit(1)
+        other_typo = typo_substrings.get(typo) or next((sub for sub in substrings(typo) if sub in typos), None)
+        if other_typo:
+            cli.log.error('{fg_red}Error:%d:{fg_reset} Typos may not be substrings of one another, otherwise the longer typo would never trigger: "{fg_cyan}%s{fg_reset}" vs. "{fg_cyan}%s{fg_reset}".', line_number, typo, other_typo)
+            maybe_exit(1)
         if len(typo) < 5:
             cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} It is suggested that typos are at least 5 characters long to avoid false triggers: "{fg_cyan}%s{fg_reset}"', line_number, typo)
         if len(typo) > 127:
             cli.log.error('{fg_red}Error:%d:{fg_reset} Typo exceeds 127 chars: "{fg_cyan}%s{fg_reset}"', line_number, typo)
             maybe_exit(1)
 
-        check_typo_against_dictionary(typo, line_number, correct_words)
-
-        autocorrections.append((typo, correction))
+        autocorrections.append((typo, correction, line_number))
         typos.add(typo)
+        for sub in substrings(typo):
+            typo_substrings.setdefault(sub, typo)
+
+    check_typos_against_dictionary(autocorrections, correct_words)
+
+    return [(typo, correction) for typo, correction, _ in autocorrections]
+
 
-    return autocorrections
+def substrings(word: str) -> Iterator[str]:
+    """Yields every substring of `word`, from longest to shortest."""
+    for length in range(len(word), 0, -1):
+        for start in range(len(word) - length + 1):
+            yield word[start:start + length]
 
 
 def make_trie(autocorrections: List[Tuple[str, str]]) -> Dict[str, Any]:
@@ -145,38 +156,97 @@ def parse_file_lines(file_name: str) -> Iterator[Tuple[int, str, str]]:
             yield line_number, typo, correction
 
 
-def check_typo_against_dictionary(typo: str, line_number: int, correct_words) -> None:
-    """Checks `typo` against English dictionary words."""
-
-    if typo.startswith(':') and typo.endswith(':'):
-        if typo[1:-1] in correct_words:
+def check_typos_against_dictionary(autocorrections: List[Tuple[str, str, int]], correct_words) -> None:
+    """Checks the typos against English dictionary words.
+  The typos are checked in one pass over the dictionary, looking up each word's
+  prefixes, suffixes and substrings of the lengths the typos have, rather than
+  comparing every typo with every word.
+  """
+    whole, prefixes, suffixes, infixes = {}, {}, {}, {}
+    for typo, _, line_number in autocorrections:
+        if typo.startswith(':') and typo.endswith(':'):
+            whole[typo[1:-1]] = (typo, line_number)
+        elif typo.startswith(':'):
+            prefixes[typo[1:]] = (typo, line_number)
+        elif typo.endswith(':'):
+            suffixes[typo[:-1]] = (typo, line_number)
+        else:
+            infixes[typo] = (typo, line_number)
+
+    prefix_lengths = {len(key) for key in prefixes}
+    suffix_lengths = {len(key) for key in suffixes}
+    infix_lengths = {len(key) for key in infixes}
+    false_triggers = []
+
+    for word in correct_words:
+        if word in whole:
+            typo, line_number = whole[word]
             cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" is a correctly spelled dictionary word.', line_number, typo)
-    elif typo.startswith(':') and not typo.endswith(':'):
-        for word in correct_words:
-            if word.startswith(typo[1:]):
-                cli.log.warning('{fg_yellow}Warning:%d: {fg_reset}Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
-    elif not typo.startswith(':') and typo.endswith(':'):
-        for word in correct_words:
-            if word.endswith(typo[:-1]):
-                cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
-    elif not typo.startswith(':') and not typo.endswith(':'):
-        for word in correct_words:
-            if typo in word:
-                cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
-
-
-def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
+        for length in prefix_lengths:
+            if word[:length] in prefixes:
+                false_triggers.append(prefixes[word[:length]] + (word, ))
+        for length in suffix_lengths:
+            if length <= len(word) and word[-length:] in suffixes:
+                false_triggers.append(suffixes[word[-length:]] + (word, ))
+        for length in infix_lengths:
+            matched = set()
+            for start in range(len(word) - length + 1):
+                infix = word[start:start + length]
+                if infix in infixes and infix not in matched:
+                    matched.add(infix)
+                    false_triggers.append(infixes[infix] + (word, ))
+
+    for typo, line_number, word in sorted(false_triggers, key=lambda trigger: trigger[1]):
+        cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
+
+
+# Trie nodes, told apart by the two high bits of their first byte
+NODE_CHAIN = 0x00  # 0b00ELLLLL: L chars, then a link if E is set, otherwise the child follows
+NODE_LIST = 0x40  # 0b01NNNNNN: N chars, then a link for each
+NODE_LEAF = 0x80  # 0b10BBBBBB: B backspaces, then the correction, NUL-terminated
+NODE_TABLE = 0xC0  # 0b11000000: a 32-bit little-endian bitmap of chars, then a link for each set bit
+CHAIN_LINK = 0x20
+CHAIN_MAX_LENGTH = 31
+
+# Nodes with at least this many children are serialized as a table. From here on a table is no larger than a list, and finding a child takes the same time whichever it is.
+TABLE_MIN_CHILDREN = 4
+
+
+# Chars are stored in the trie as their index in this string
+TRIE_CHARS = 'abcdefghijklmnopqrstuvwxyz\':'
+
+
+class TrieNode:
+    """A node of the serialized trie: a chain of single children, a branch or a leaf."""
+    def __init__(self, kind: int, chars: str = '', children: Optional[List['TrieNode']] = None, data: Optional[List[int]] = None) -> None:
+        self.kind = kind
+        self.chars = chars
+        self.children = children or []
+        self.data = data or []
+        # Children are shared before their parents are made, so identical subtrees have identical keys
+        self.key = (kind, chars, tuple(id(child) for child in self.children), tuple(self.data))
+
+
+def char_index(c: str) -> int:
+    """Maps a typo character to its index in the trie: a-z, then ' and the word break."""
+    return TRIE_CHARS.index(c)
+
+
+def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> Tuple[List[int], int]:
     """Serializes trie and correction data in a form readable by the C code.
+  Identical subtrees, such as the same correction reached through different typos, are serialized once and shared.
   Args:
     autocorrections: List of (typo, correction) tuples.
     trie: Dict of dicts.
   Returns:
-    List of ints in the range 0-255.
+    List of ints in the range 0-255, and the size of a node link in bytes.
   """
-    table = []
+    nodes: Dict[Tuple, TrieNode] = {}
+
+    def shared(node: TrieNode) -> TrieNode:
+        return nodes.setdefault(node.key, node)
 
-    # Traverse trie in depth first order.
-    def traverse(trie_node):
+    def build(trie_node: Dict[str, Any]) -> TrieNode:
         if 'LEAF' in trie_node:  # Handle a leaf trie node.
             typo, correction = trie_node['LEAF']
             word_boundary_ending = typo[-1] == ':'
@@ -186,59 +256,100 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
                 i += 1
             backspaces = len(typo) - i - 1 + word_boundary_ending
             assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
-
-            entry = {'data': data, 'links': [], 'byte_offset': 0}
-            table.append(entry)
+            return shared(TrieNode(NODE_LEAF, data=[NODE_LEAF | backspaces] + list(bytes(correction[i:], 'ascii')) + [0]))
         elif len(trie_node) == 1:  # Handle trie node with a single child.
-            c, trie_node = next(iter(trie_node.items()))
-            entry = {'chars': c, 'byte_offset': 0}
-
-            # It's common for a trie to have long chains of single-child nodes. We
-            # find the whole chain so that we can serialize it more efficiently.
+            # It's common for a trie to have long chains of single-child nodes, so the whole chain is one node.
+            chars = ''
             while len(trie_node) == 1 and 'LEAF' not in trie_node:
                 c, trie_node = next(iter(trie_node.items()))
-                entry['chars'] += c
-
-            table.append(entry)
-            entry['links'] = [traverse(trie_node)]
+                chars += c
+            node = build(trie_node)
+            pieces = [chars[i:i + CHAIN_MAX_LENGTH] for i in range(0, len(chars), CHAIN_MAX_LENGTH)]
+            for piece in reversed(pieces):
+                node = shared(TrieNode(NODE_CHAIN, piece, [node]))
+            return node
         else:  # Handle trie node with multiple children.
-            entry = {'chars': ''.join(sorted(trie_node.keys())), 'byte_offset': 0}
-            table.append(entry)
-            entry['links'] = [traverse(trie_node[c]) for c in entry['chars']]
-        return entry
-
-    traverse(trie)
-
-    def serialize(e: Dict[str, Any]) -> List[int]:
-        if not e['links']:  # Handle a leaf table entry.
-            return e['data']
-        elif len(e['links']) == 1:  # Handle a chain table entry.
-            return [TYPO_CHARS[c] for c in e['chars']] + [0]  # + encode_link(e['links'][0]))
-        else:  # Handle a branch table entry.
-            data = []
-            for c, link in zip(e['chars'], e['links']):
-                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link)
-            return data + [0]
-
-    byte_offset = 0
-    for e in table:  # To encode links, first compute byte offset of each entry.
-        e['byte_offset'] = byte_offset
-        byte_offset += len(serialize(e))
-        assert 0 <= byte_offset <= 0xffff
-
-    return [b for e in table for b in serialize(e)]  # Serialize final table.
-
-
-def encode_link(link: Dict[str, Any]) -> List[int]:
-    """Encodes a node link as two bytes."""
-    byte_offset = link['byte_offset']
-    if not (0 <= byte_offset <= 0xffff):
-        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 64KB limit. Try reducing the autocorrection dict to fewer entries.')
-        maybe_exit(1)
-    return [byte_offset & 255, byte_offset >> 8]
+            chars = ''.join(sorted(trie_node.keys(), key=char_index))
+            kind = NODE_TABLE if len(chars) >= TABLE_MIN_CHILDREN else NODE_LIST
+            return shared(TrieNode(kind, chars, [build(trie_node[c]) for c in chars]))
+
+    root = build(trie)
+
+    for link_size in (2, 3):
+        data = layout_trie(root, link_size)
+        if len(data) <= 1 << (8 * link_size):
+            return data, link_size
+
+    cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 16MB limit. Try reducing the autocorrection dict to fewer entries.')
+    maybe_exit(1)
+
+
+def layout_trie(root: TrieNode, link_size: int) -> List[int]:
+    """Lays the nodes out depth first from the root, and serializes them with links of `link_size` bytes."""
+    placements = []  # (node, chain links explicitly)
+    offsets: Dict[int, int] = {}
+    size = 0
+
+    def place(node: TrieNode) -> None:
+        nonlocal size
+        while node is not None:
+            next_node = None
+            explicit = False
+            if node.kind == NODE_CHAIN:
+                child = node.children[0]
+                # The child of a chain goes right after it. If it is already placed elsewhere, link to it unless copying it is no larger.
+                if id(child) not in offsets:
+                    next_node = child
+                elif child.kind == NODE_LEAF and len(child.data) <= link_size:
+                    next_node = TrieNode(NODE_LEAF, data=child.data)
+                else:
+                    explicit = True
+            offsets.setdefault(id(node), size)
+            placements.append((node, explicit))
+            size += node_size(node, explicit, link_size)
+            if node.kind in (NODE_LIST, NODE_TABLE):
+                for child in node.children:
+                    if id(child) not in offsets:
+                        place(child)
+            node = next_node
+
+    place(root)
+
+    def link(node: TrieNode) -> List[int]:
+        return [(offsets[id(node)] >> (8 * i)) & 0xFF for i in range(link_size)]
+
+    data = []
+    for node, explicit in placements:
+        if node.kind == NODE_LEAF:
+            data += node.data
+        elif node.kind == NODE_CHAIN:
+            data += [NODE_CHAIN | (CHAIN_LINK if explicit else 0) | len(node.chars)] + [char_index(c) for c in node.chars]
+            if explicit:
+                data += link(node.children[0])
+        elif node.kind == NODE_LIST:
+            data += [NODE_LIST | len(node.chars)] + [char_index(c) for c in node.chars]
+            for child in node.children:
+                data += link(child)
+        else:
+            bitmap = sum(1 << char_index(c) for c in node.chars)
+            data += [NODE_TABLE] + [(bitmap >> (8 * i)) & 0xFF for i in range(4)]
+            for child in node.children:
+                data += link(child)
+
+    assert len(data) == size
+    return data
+
+
+def node_size(node: TrieNode, explicit: bool, link_size: int) -> int:
+    """Returns the number of bytes the node takes up."""
+    if node.kind == NODE_LEAF:
+        return len(node.data)
+    elif node.kind == NODE_CHAIN:
+        return 1 + len(node.chars) + (link_size if explicit else 0)
+    elif node.kind == NODE_LIST:
+        return 1 + len(node.chars) * (1 + link_size)
+    else:
+        return 1 + 4 + len(node.chars) * link_size
 
 
 def typo_len(e: Tuple[str, str]) -> int:
@@ -258,7 +369,7 @@ def to_hex(b: int) -> str:
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    data, link_size = serialize_trie(autocorrections, trie)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -282,6 +393,8 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
+    autocorrect_data_h_lines.append('#define AUTOCORRECT_DATA_VERSION 2')
+    autocorrect_data_h_lines.append(f'#define AUTOCORRECT_LINK_SIZE {link_size}')
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
     autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
@@ -0,0 +1,292 @@
+"""Used by the make system to generate combo_index.h from a keymap's combos.
+
+The index maps each keycode used by a combo to the combos that contain it, so
+process_combo() only has to look at the combos a key event could match rather
+than walking all of key_combos[].
+"""
+import re
+
+from milc import cli
+
+from qmk.c_parse import strip_line_comment, strip_multiline_comment
+from qmk.commands import dump_lines
+from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE
+from qmk.keyboard import keyboard_completer, keyboard_folder
+from qmk.keycodes import load_spec
+from qmk.keymap import keymap_completer, locate_keymap
+from qmk.path import normpath
+from qmk.util import maybe_exit
+
+key_combos_regex = re.compile(r'\bkey_combos\s*\[[^\]]*\]\s*=\s*\{')
+array_regex = re.compile(r'\b(\w+)\s*\[[^\]]*\]\s*=\s*\{([^{}]*)\}')
+enum_regex = re.compile(r'\benum\b\s*\w*\s*\{([^{}]*)\}')
+define_regex = re.compile(r'^[ \t]*#[ \t]*define[ \t]+(\w+)[ \t]+(.+?)[ \t]*$', re.MULTILINE)
+identifier_regex = re.compile(r'\b[A-Za-z_]\w*\b')
+combo_entry_regex = re.compile(r'(?:\[\s*(\w+)\s*\]\s*=\s*)?(?:COMBO(?:_ACTION)?\s*\(\s*(\w+)\s*[,)].*|\{.*?\.keys\s*=\s*&?\s*\(?\s*(\w+).*\})', re.DOTALL)
+directive_regex = re.compile(r'^[ \t]*#', re.MULTILINE)
+
+
+class ComboParseError(Exception):
+    """The combos can't be read from the keymap, so no index can be generated.
+    """
+
+
+def _strip_comments(text):
+    text = strip_multiline_comment(text)
+    return '\n'.join(strip_line_comment(line) for line in text.split('\n'))
+
+
+def _split_tokens(body):
+    """Split a C initializer body on the commas that aren't nested inside parentheses or braces.
+    """
+    tokens = []
+    depth = 0
+    token = ''
+    for c in body:
+        if c == ',' and depth == 0:
+            tokens.append(token.strip())
+            token = ''
+            continue
+        depth += (c in '({') - (c in ')}')
+        token += c
+    tokens.append(token.strip())
+
+    return [t for t in tokens if t]
+
+
+def _matching_brace(text, start):
+    """Returns the position just past the brace closing the one at text[start - 1].
+    """
+    depth = 1
+    pos = start
+    while depth and pos < len(text):
+        depth += (text[pos] == '{') - (text[pos] == '}')
+        pos += 1
+
+    return pos
+
+
+def _enum_values(text):
+    """Returns the implicit value of each enum member, skipping members with an explicit initializer other than 0.
+    """
+    values = {}
+    for match in enum_regex.finditer(text):
+        # Members behind #if can't be counted
+        if directive_regex.search(match.group(1)):
+            continue
+        value = 0
+        for member in _split_tokens(match.group(1)):
+            name, _, initializer = member.partition('=')
+            name = name.strip()
+            if initializer.strip() not in ('', '0'):
+                break
+            values[name] = value
+            value += 1
+
+    return values
+
+
+def _normalize(token):
+    """Drops the whitespace that doesn't separate two words, so `LT(1, KC_A)` and `LT(1,KC_A)` are the same token.
+    """
+    return re.sub(r'\s+', ' ', re.sub(r'\s*([^\w\s])\s*', r'\1', token)).strip()
+
+
+def _expand_defines(token, defines, depth=8):
+    """Expands object-like macros in a keycode token, so a keycode given a name with `#define` shares an entry with the keycode itself.
+    """
+    for _ in range(depth):
+        expanded = _normalize(identifier_regex.sub(lambda match: defines.get(match.group(0), match.group(0)), token))
+        if expanded == token:
+            break
+        token = expanded
+
+    return token
+
+
+def parse_combos(text):
+    """Returns the list of keycode tokens making up each entry of key_combos[], in combo index order.
+
+    Raises ComboParseError if the combos can't be read exactly, such as when they are generated by macros or
+    depend on #if.
+    """
+    text = _strip_comments(text)
+
+    matches = list(key_combos_regex.finditer(text))
+    if not matches:
+        if 'combos.def' in text or 'keymap_combo.h' in text:
+            raise ComboParseError('key_combos[] is generated from combos.def')
+        raise ComboParseError('could not find key_combos[]')
+    if len(matches) > 1:
+        raise ComboParseError('key_combos[] is defined more than once')
+
+    body = text[matches[0].end():_matching_brace(text, matches[0].end()) - 1]
+    if directive_regex.search(body):
+        raise ComboParseError('key_combos[] contains preprocessor directives such as #if')
+
+    arrays = {}
+    for name, array in array_regex.findall(text):
+        if name in arrays:
+            raise ComboParseError(f'{name}[] is defined more than once')
+        arrays[name] = array
+    enums = _enum_values(text)
+    defines = dict(define_regex.findall(text))
+
+    combos = {}
+    next_index = 0
+    for token in _split_tokens(body):
+        entry = combo_entry_regex.fullmatch(token)
+        if not entry:
+            raise ComboParseError(f'could not read the combo {_normalize(token)}')
+        designator, array_name = entry.group(1), entry.group(2) or entry.group(3)
+
+        if designator:
+            if designator.isdigit():
+                next_index = int(designator)
+            elif designator in enums:
+                next_index = enums[designator]
+            else:
+                raise ComboParseError(f'could not resolve the combo index {designator}')
+
+        if array_name not in arrays:
+            raise ComboParseError(f'could not find the keys of the combo {array_name}')
+        if directive_regex.search(arrays[array_name]):
+            raise ComboParseError(f'{array_name}[] contains preprocessor directives such as #if')
+
+        keys = []
+        for key in _split_tokens(arrays[array_name]):
+            if key in ('COMBO_END', '0'):
+                break
+            keys.append(_expand_defines(_normalize(key), defines))
+
+        combos[next_index] = keys
+        next_index += 1
+
+    if sorted(combos) != list(range(len(combos))):
+        raise ComboParseError('the entries of key_combos[] are not contiguous')
+
+    return [combos[index] for index in range(len(combos))]
+
+
+def build_index(combos, spec):
+    """Group combos by keycode.
+
+    Keycodes are resolved through the keycode spec where possible, so aliases share an entry. Keycodes that don't resolve, such as `LT(1, KC_ENT)`, have the keycodes inside them resolved instead, so they are written the same way however the keymap spells them. If every keycode resolves the index is sorted by value, so the firmware can binary search it. Returns the index and the keycodes that didn't resolve.
+    """
+    values = {}
+    names = {}
+    for hex_value, keycode in spec.get('keycodes', {}).items():
+        for name in [keycode['key']] + keycode.get('aliases', []):
+            values[name] = int(hex_value, 16)
+            names[name] = keycode['key']
+
+    def canonical(key):
+        if key in names:
+            return names[key]
+        return identifier_regex.sub(lambda match: names.get(match.group(0), match.group(0)), key)
+
+    index = {}
+    for combo_index, keys in enumerate(combos):
+        for key in keys:
+            combo_list = index.setdefault(canonical(key), [])
+            if combo_index not in combo_list:
+                combo_list.append(combo_index)
+
+    unresolved = [key for key in index if key not in values]
+    if not unresolved:
+        index = dict(sorted(index.items(), key=lambda item: values[item[0]]))
+
+    return index, unresolved
+
+
+def generate_combo_index_h(combos, index, unresolved):
+    lines = [GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, '#pragma once', '']
+
+    lines.append(f'#define COMBO_INDEX_COMBO_COUNT {len(combos)}')
+    lines.append(f'#define COMBO_INDEX_KEYCODE_COUNT {len(index)}')
+    if not unresolved:
+        lines.append('#define COMBO_INDEX_SORTED')
+    lines.append('')
+
+    offsets = [0]
+    entries = []
+    for combo_list in index.values():
+        entries.extend(combo_list)
+        offsets.append(len(entries))
+
+    lines.append('static const uint16_t PROGMEM combo_index_keycodes[COMBO_INDEX_KEYCODE_COUNT] = {')
+    lines.extend(f'    {keycode},' for keycode in index)
+    lines.append('};')
+    lines.append('')
+    lines.append('// Where each keycode\'s combos start in combo_index_combos[], the last entry marks the end')
+    lines.append('static const uint16_t PROGMEM combo_index_offsets[COMBO_INDEX_KEYCODE_COUNT + 1] = {')
+    lines.append(f'    {", ".join(str(offset) for offset in offsets)}')
+    lines.append('};')
+    lines.append('')
+    lines.append(f'static const uint16_t PROGMEM combo_index_combos[{len(entries)}] = {{')
+    lines.append(f'    {", ".join(str(entry) for entry in entries)}')
+    lines.append('};')
+
+    # A keycode that couldn't be resolved might still be the same keycode as another entry, whose combos would then never
+    # be found. The compiler rejects duplicate case labels, so this checks every keycode is unique in one pass.
+    if unresolved:
+        lines.append('')
+        lines.append('// Fails to compile with a duplicate case value if two entries are the same keycode, write it the same way in every combo')
+        lines.append('static inline void combo_index_check_keycodes(uint16_t keycode) {')
+        lines.append('    switch (keycode) {')
+        lines.extend(f'        case {keycode}:' for keycode in index)
+        lines.append('            break;')
+        lines.append('    }')
+        lines.append('}')
+
+    return lines
+
+
+def generate_combo_index_fallback_h(reason):
+    """The header for keymaps whose combos can't be indexed, every combo is then checked on each key event.
+    """
+    message = str(reason).replace('\\', '\\\\').replace('"', '\\"')
+    return [
+        GPL2_HEADER_C_LIKE,
+        GENERATED_HEADER_C_LIKE,
+        '#pragma once',
+        '',
+        f'// The combos could not be indexed: {reason}',
+        '#define COMBO_INDEX_FALLBACK',
+        '',
+        f'#pragma message "COMBO_INDEX_ENABLE: {message}, checking every combo instead"',
+    ]
+
+
+@cli.argument('filenames', nargs='*', type=normpath, arg_only=True, help='The C files defining key_combos[] and the combo key arrays')
+@cli.argument('-kb', '--keyboard', type=keyboard_folder, completer=keyboard_completer, help='The keyboard to build a firmware for.')
+@cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for.')
+@cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
+@cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.subcommand('Generate the combo index from a keymap\'s combos.')
+def generate_combo_index(cli):
+    """Generates the combo_index.h file.
+    """
+    current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_combo_index.keyboard
+    current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_combo_index.keymap
+
+    sources = cli.args.filenames
+    if not sources and current_keyboard and current_keymap:
+        keymap_c = locate_keymap(current_keyboard, current_keymap)
+        sources = [keymap_c] if keymap_c else []
+
+    if not sources or any(source.suffix != '.c' for source in sources):
+        cli.log.error('You must supply the C files defining the combos, or a `--keyboard` and `--keymap` with a C keymap.')
+        maybe_exit(1)
+        return False
+
+    try:
+        combos = parse_combos('\n'.join(source.read_text(encoding='utf-8') for source in sources))
+    except ComboParseError as e:
+        cli.log.warning('Could not index the combos, every combo will be checked on each key event: %s.', e)
+        dump_lines(cli.args.output, generate_combo_index_fallback_h(e), cli.args.quiet)
+        return
+
+    index, unresolved = build_index(combos, load_spec('latest'))
+
+    dump_lines(cli.args.output, generate_combo_index_h(combos, index, unresolved), cli.args.quiet)
@@ -6,7 +6,7 @@ from dotty_dict import dotty
 from argcomplete.completers import FilesCompleter
 from milc import cli
 
-from qmk.info import info_json
+from qmk.info import info_json, matrix_key_positions
 from qmk.json_schema import json_load
 from qmk.keyboard import keyboard_completer, keyboard_folder
 from qmk.commands import dump_lines, parse_configurator_json
@@ -85,6 +85,17 @@ def generate_matrix_masked(kb_info_json, config_h_lines):
         config_h_lines.append(generate_define('MATRIX_MASKED'))
 
 
+def generate_matrix_key_count(kb_info_json, config_h_lines):
+    """Add the number of matrix positions used by the layouts to the config.h.
+    """
+    if 'matrix_size' not in kb_info_json or 'layouts' not in kb_info_json:
+        return
+
+    positions = matrix_key_positions(kb_info_json)
+    if positions:
+        config_h_lines.append(generate_define('MATRIX_KEY_COUNT', len(positions)))
+
+
 def generate_config_items(kb_info_json, config_h_lines):
     """Iterate through the info_config map to generate basic config values.
     """
@@ -204,6 +215,8 @@ def generate_config_h(cli):
 
     generate_matrix_masked(kb_info_json, config_h_lines)
 
+    generate_matrix_key_count(kb_info_json, config_h_lines)
+
     if 'matrix_pins' in kb_info_json:
         config_h_lines.append(matrix_pins(kb_info_json['matrix_pins']))
 
@@ -2,7 +2,7 @@
 """
 from milc import cli
 
-from qmk.info import info_json
+from qmk.info import info_json, matrix_key_positions
 from qmk.commands import dump_lines
 from qmk.keyboard import keyboard_completer, keyboard_folder
 from qmk.path import normpath
@@ -91,6 +91,32 @@ def _gen_matrix_mask(info_data):
     return lines
 
 
+def _gen_matrix_key_index(info_data):
+    """Convert info.json content to matrix_key_index, matching MATRIX_KEY_COUNT in info_config.h
+    """
+    cols = info_data['matrix_size']['cols']
+    rows = info_data['matrix_size']['rows']
+
+    positions = matrix_key_positions(info_data)
+    if not positions:
+        return []
+
+    # Unused matrix positions share the slot after the last used one
+    index = [[str(len(positions))] * cols for _ in range(rows)]
+    for slot, (row, col) in enumerate(positions):
+        index[row][col] = str(slot)
+
+    lines = []
+    lines.append('#if defined(SOURCE_LAYERS_CACHE_COMPACT) && defined(MATRIX_KEY_COUNT) && (MATRIX_KEY_COUNT < 255)')
+    lines.append('__attribute__((weak)) const uint8_t matrix_key_index[MATRIX_ROWS][MATRIX_COLS] PROGMEM = {')
+    for line in index:
+        lines.append(f'    {{ {", ".join(line)} }},')
+    lines.append('};')
+    lines.append('#endif')
+
+    return lines
+
+
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
 @cli.argument('-kb', '--keyboard', arg_only=True, type=keyboard_folder, completer=keyboard_completer, required=True, help='Keyboard to generate keyboard.c for.')
@@ -105,6 +131,7 @@ def generate_keyboard_c(cli):
 
     keyboard_h_lines.extend(_gen_led_configs(kb_info_json))
     keyboard_h_lines.extend(_gen_matrix_mask(kb_info_json))
+    keyboard_h_lines.extend(_gen_matrix_key_index(kb_info_json))
 
     # Show the results
     dump_lines(cli.args.output, keyboard_h_lines, cli.args.quiet)
@@ -805,6 +805,25 @@ def _matrix_size(info_data):
     return info_data
 
 
+def matrix_key_positions(info_data):
+    """Returns the sorted (row, col) matrix positions used by any layout, or None if a layout references a position outside the matrix.
+    """
+    cols = info_data['matrix_size']['cols']
+    rows = info_data['matrix_size']['rows']
+    positions = set()
+
+    for layout_data in info_data.get('layouts', {}).values():
+        for key_data in layout_data['layout']:
+            if 'matrix' not in key_data:
+                continue
+            row, col = key_data['matrix']
+            if row >= rows or col >= cols:
+                return None
+            positions.add((row, col))
+
+    return sorted(positions)
+
+
 def _check_matrix(info_data):
     """Check the matrix to ensure that row/column count is consistent.
     """
@@ -279,6 +279,13 @@ def test_generate_config_h():
     assert '#    define MATRIX_ROW_PINS { F5 }' in result.stdout
 
 
+def test_generate_combo_index():
+    result = check_subcommand('generate-combo-index', 'tests/combo_index/test_combos.c')
+    check_returncode(result)
+    with open('tests/combo_index/combo_index.h', encoding='utf-8') as expected:
+        assert result.stdout.strip() == expected.read().strip()
+
+
 def test_generate_rules_mk():
     result = check_subcommand('generate-rules-mk', '-kb', 'handwired/pytest/basic')
     check_returncode(result)
@@ -0,0 +1,125 @@
+import pytest
+
+from qmk.cli.generate.combo_index import ComboParseError, build_index, generate_combo_index_fallback_h, generate_combo_index_h, parse_combos
+
+spec = {
+    'keycodes': {
+        '0x0004': {'key': 'KC_A'},
+        '0x0005': {'key': 'KC_B'},
+        '0x0028': {'key': 'KC_ENTER', 'aliases': ['KC_ENT']},
+        '0x0029': {'key': 'KC_ESCAPE', 'aliases': ['KC_ESC']},
+    },
+}
+
+
+def test_parse_combos_in_enum_order():
+    combos = parse_combos('''
+        enum combos { ESC_COMBO, ENT_COMBO };
+        const uint16_t PROGMEM ent_combo[] = {KC_A, KC_ENT, COMBO_END};
+        const uint16_t PROGMEM esc_combo[] = {KC_A, KC_B, COMBO_END};
+        combo_t key_combos[] = {
+            [ENT_COMBO] = COMBO(ent_combo, KC_X),
+            [ESC_COMBO] = COMBO(esc_combo, KC_Y),
+        };
+    ''')
+    assert combos == [['KC_A', 'KC_B'], ['KC_A', 'KC_ENT']]
+
+
+def test_aliases_share_an_entry():
+    index, unresolved = build_index([['KC_A', 'KC_ENT'], ['KC_B', 'KC_ENTER']], spec)
+    assert index == {'KC_A': [0], 'KC_B': [1], 'KC_ENTER': [0, 1]}
+    assert unresolved == []
+    assert '#define COMBO_INDEX_SORTED' in generate_combo_index_h([[], []], index, unresolved)
+
+
+def test_spellings_of_the_same_keycode_share_an_entry():
+    combos = parse_combos('''
+        #define NAV 1
+        #define MY_ESC KC_ESC
+        const uint16_t PROGMEM a_combo[] = {LT(1, KC_A), KC_ESCAPE, COMBO_END};
+        const uint16_t PROGMEM b_combo[] = {LT(NAV,KC_A), MY_ESC, COMBO_END};
+        const uint16_t PROGMEM c_combo[] = {LT( 1 , KC_A ), KC_B, COMBO_END};
+        combo_t key_combos[] = {
+            COMBO(a_combo, KC_X),
+            COMBO(b_combo, KC_Y),
+            COMBO(c_combo, KC_Z),
+        };
+    ''')
+    index, unresolved = build_index(combos, spec)
+    assert index == {'LT(1,KC_A)': [0, 1, 2], 'KC_ESCAPE': [0, 1], 'KC_B': [2]}
+    assert unresolved == ['LT(1,KC_A)']
+
+
+def test_unresolved_keycodes_are_checked_once_each():
+    index, unresolved = build_index([['KC_A', 'MY_KEY'], ['OTHER_KEY', 'KC_B']], spec)
+    lines = generate_combo_index_h([[], []], index, unresolved)
+    assert [line.strip() for line in lines if line.strip().startswith('case ')] == ['case KC_A:', 'case MY_KEY:', 'case OTHER_KEY:', 'case KC_B:']
+    assert not any(line.startswith('_Static_assert') for line in lines)
+
+
+def test_resolved_keycodes_need_no_check():
+    index, unresolved = build_index([['KC_A', 'KC_B']], spec)
+    assert not any('switch' in line for line in generate_combo_index_h([[]], index, unresolved))
+
+
+def test_combos_def_falls_back():
+    with pytest.raises(ComboParseError, match='combos.def'):
+        parse_combos('#include "g/keymap_combo.h"')
+
+
+def test_combos_behind_if_fall_back():
+    with pytest.raises(ComboParseError, match='#if'):
+        parse_combos('''
+            const uint16_t PROGMEM a_combo[] = {KC_A, KC_B, COMBO_END};
+            const uint16_t PROGMEM b_combo[] = {KC_A, KC_ENT, COMBO_END};
+            combo_t key_combos[] = {
+                COMBO(a_combo, KC_X),
+            #ifdef B_COMBO
+                COMBO(b_combo, KC_Y),
+            #endif
+            };
+        ''')
+
+
+def test_keys_behind_if_fall_back():
+    with pytest.raises(ComboParseError, match='more than once'):
+        parse_combos('''
+            #ifdef WIDE
+            const uint16_t PROGMEM a_combo[] = {KC_A, KC_B, KC_ENT, COMBO_END};
+            #else
+            const uint16_t PROGMEM a_combo[] = {KC_A, KC_B, COMBO_END};
+            #endif
+            combo_t key_combos[] = {COMBO(a_combo, KC_X)};
+        ''')
+
+
+def test_enum_behind_if_falls_back():
+    with pytest.raises(ComboParseError, match='A_COMBO'):
+        parse_combos('''
+            enum combos {
+            #ifdef B_COMBO
+                B_COMBO,
+            #endif
+                A_COMBO,
+            };
+            const uint16_t PROGMEM a_combo[] = {KC_A, KC_B, COMBO_END};
+            combo_t key_combos[] = {[A_COMBO] = COMBO(a_combo, KC_X)};
+        ''')
+
+
+def test_unknown_combo_entry_falls_back():
+    with pytest.raises(ComboParseError, match='MY_COMBO'):
+        parse_combos('''
+            const uint16_t PROGMEM a_combo[] = {KC_A, KC_B, COMBO_END};
+            combo_t key_combos[] = {
+                COMBO(a_combo, KC_X),
+                MY_COMBO(KC_A, KC_ENT),
+            };
+        ''')
+
+
+def test_fallback_checks_every_combo():
+    lines = generate_combo_index_fallback_h(ComboParseError('key_combos[] is generated from combos.def'))
+    assert '#define COMBO_INDEX_FALLBACK' in lines
+    assert '#pragma message "COMBO_INDEX_ENABLE: key_combos[] is generated from combos.def, checking every combo instead"' in lines
+    assert not any('combo_index_keycodes' in line for line in lines)
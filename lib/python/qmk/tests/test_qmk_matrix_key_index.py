@@ -0,0 +1,44 @@
+from qmk.info import matrix_key_positions
+from qmk.cli.generate.config_h import generate_matrix_key_count
+from qmk.cli.generate.keyboard_c import _gen_matrix_key_index
+
+info_data = {
+    'matrix_size': {'rows': 2, 'cols': 3},
+    'layouts': {
+        'LAYOUT': {'layout': [{'matrix': [1, 2]}, {'matrix': [0, 0]}, {'x': 1, 'y': 0}]},
+        'LAYOUT_alt': {'layout': [{'matrix': [0, 0]}, {'matrix': [0, 1]}]},
+    },
+}
+
+
+def test_matrix_key_positions_sorted_and_unique():
+    assert matrix_key_positions(info_data) == [(0, 0), (0, 1), (1, 2)]
+
+
+def test_matrix_key_positions_outside_matrix():
+    outside = {
+        'matrix_size': {'rows': 2, 'cols': 3},
+        'layouts': {'LAYOUT': {'layout': [{'matrix': [0, 0]}, {'matrix': [2, 0]}]}},
+    }
+    assert matrix_key_positions(outside) is None
+
+
+def test_generate_matrix_key_count():
+    config_h_lines = []
+    generate_matrix_key_count(info_data, config_h_lines)
+    assert len(config_h_lines) == 1
+    assert '#    define MATRIX_KEY_COUNT 3' in config_h_lines[0]
+
+
+def test_generate_matrix_key_count_without_layouts():
+    config_h_lines = []
+    generate_matrix_key_count({'matrix_size': {'rows': 2, 'cols': 3}}, config_h_lines)
+    assert config_h_lines == []
+
+
+def test_matrix_key_index_unused_positions_share_last_slot():
+    lines = _gen_matrix_key_index(info_data)
+    assert lines[0] == '#if defined(SOURCE_LAYERS_CACHE_COMPACT) && defined(MATRIX_KEY_COUNT) && (MATRIX_KEY_COUNT < 255)'
+    assert lines[2] == '    { 0, 1, 3 },'
+    assert lines[3] == '    { 3, 3, 2 },'
+    assert lines[-1] == '#endif'
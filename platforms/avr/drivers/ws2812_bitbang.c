@@ -41,6 +41,11 @@ void ws2812_init(void) {
     DDRx_ADDRESS(WS2812_DI_PIN) |= pinmask(WS2812_DI_PIN);
 }
 
+// Frames are sent before ws2812_setleds() returns
+bool ws2812_busy(void) {
+    return false;
+}
+
 void ws2812_setleds(rgb_led_t *ledarray, uint16_t number_of_leds) {
     uint8_t masklo = ~(pinmask(WS2812_DI_PIN)) & PORTx_ADDRESS(WS2812_DI_PIN);
     uint8_t maskhi = pinmask(WS2812_DI_PIN) | PORTx_ADDRESS(WS2812_DI_PIN);
@@ -17,6 +17,11 @@ void ws2812_init(void) {
     i2c_init();
 }
 
+// Frames are sent before ws2812_setleds() returns
+bool ws2812_busy(void) {
+    return false;
+}
+
 // Setleds for standard RGB
 void ws2812_setleds(rgb_led_t *ledarray, uint16_t leds) {
     i2c_transmit(WS2812_I2C_ADDRESS, (uint8_t *)ledarray, sizeof(rgb_led_t) * leds, WS2812_I2C_TIMEOUT);
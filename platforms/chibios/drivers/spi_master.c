@@ -19,6 +19,8 @@
 #include "timer.h"
 
 static bool spiStarted = false;
+// Whether the current device was left selected by spi_transmit_async()
+static bool spiAsyncStarted = false;
 
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
 static pin_t currentSlavePin;
@@ -26,6 +28,12 @@ static pin_t currentSlavePin;
 
 static SPIConfig spiConfig;
 
+// Waits for a transfer started by spi_transmit_async() to complete
+static inline void spi_wait_idle(void) {
+    while (*(volatile spistate_t *)&SPI_DRIVER.state == SPI_ACTIVE) {
+    }
+}
+
 __attribute__((weak)) void spi_init(void) {
     static bool is_initialised = false;
     if (!is_initialised) {
@@ -64,6 +72,10 @@ __attribute__((weak)) void spi_init(void) {
 }
 
 bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
+    // An asynchronous transfer only holds on to the bus until it completes, then other devices may take it over
+    if (spiAsyncStarted) {
+        spi_stop();
+    }
     if (spiStarted) {
         return false;
     }
@@ -293,6 +305,7 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
 
 spi_status_t spi_write(uint8_t data) {
     uint8_t rxData;
+    spi_wait_idle();
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
     return rxData;
@@ -300,23 +313,38 @@ spi_status_t spi_write(uint8_t data) {
 
 spi_status_t spi_read(void) {
     uint8_t data = 0;
+    spi_wait_idle();
     spiReceive(&SPI_DRIVER, 1, &data);
 
     return data;
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_wait_idle();
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spi_wait_idle();
+    spiAsyncStarted = true;
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+bool spi_busy(void) {
+    return *(volatile spistate_t *)&SPI_DRIVER.state == SPI_ACTIVE;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_wait_idle();
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
     if (spiStarted) {
+        spi_wait_idle();
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
         if (currentSlavePin != NO_PIN) {
             gpio_write_pin_high(currentSlavePin);
@@ -324,6 +352,7 @@ void spi_stop(void) {
 #endif
         spiUnselect(&SPI_DRIVER);
         spiStop(&SPI_DRIVER);
-        spiStarted = false;
+        spiStarted      = false;
+        spiAsyncStarted = false;
     }
 }
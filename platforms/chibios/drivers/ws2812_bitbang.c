@@ -80,6 +80,11 @@ void ws2812_init(void) {
     palSetLineMode(WS2812_DI_PIN, WS2812_OUTPUT_MODE);
 }
 
+// Frames are sent before ws2812_setleds() returns
+bool ws2812_busy(void) {
+    return false;
+}
+
 // Setleds for standard RGB
 void ws2812_setleds(rgb_led_t *ledarray, uint16_t leds) {
     // this code is very time dependent, so we need to disable interrupts
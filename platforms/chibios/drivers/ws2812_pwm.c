@@ -300,22 +300,71 @@ typedef uint16_t ws2812_buffer_t;
 typedef uint8_t ws2812_buffer_t;
 #endif
 
-static ws2812_buffer_t ws2812_frame_buffer[WS2812_BIT_N + 1]; /**< Buffer for a frame */
+// M2P: Memory 2 Periph; PL: Priority Level; TCIE: interrupt at the end of the frame
+#if defined(WB32F3G71xx) || defined(WB32FQ95xx)
+#    define WS2812_PWM_DMA_MODE (WB32_DMA_CHCFG_HWHIF(WS2812_PWM_DMA_CHANNEL) | WB32_DMA_CHCFG_DIR_M2P | WB32_DMA_CHCFG_PSIZE_WORD | WB32_DMA_CHCFG_MSIZE_WORD | WB32_DMA_CHCFG_MINC | WB32_DMA_CHCFG_TCIE | WB32_DMA_CHCFG_PL(3))
+#else
+#    define WS2812_PWM_DMA_MODE (STM32_DMA_CR_CHSEL(WS2812_PWM_DMA_CHANNEL) | STM32_DMA_CR_DIR_M2P | WS2812_PWM_DMA_PERIPHERAL_WIDTH | WS2812_PWM_DMA_MEMORY_WIDTH | STM32_DMA_CR_MINC | STM32_DMA_CR_TCIE | STM32_DMA_CR_PL(3))
+#endif
 
-/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 /*
- * Gedanke: Double-buffer type transactions: double buffer transfers using two memory pointers for
- * the memory (while the DMA is reading/writing from/to a buffer, the application can
- * write/read to/from the other buffer).
+ * Each frame is sent once by the DMA, which raises an interrupt when it is done. With WS2812_DOUBLE_BUFFER, the next
+ * frame is written to a second buffer while the DMA is reading from the first one, and is sent straight after it.
  */
+#ifdef WS2812_DOUBLE_BUFFER
+#    define WS2812_PWM_BUFFER_COUNT 2
+#else
+#    define WS2812_PWM_BUFFER_COUNT 1
+#endif
+
+static ws2812_buffer_t ws2812_frame_buffer[WS2812_PWM_BUFFER_COUNT][WS2812_BIT_N + 1]; /**< Buffers for a frame */
+
+static volatile bool    ws2812_sending = false; /**< A frame is being sent */
+static volatile bool    ws2812_pending = false; /**< The buffer not being sent holds a frame, to be sent next */
+static volatile uint8_t ws2812_front   = 0;     /**< The buffer being sent, or sent last */
+
+/* --- PRIVATE FUNCTIONS ---------------------------------------------------- */
+
+static void ws2812_start_frame(ws2812_buffer_t* buffer) {
+    dmaStreamDisable(WS2812_PWM_DMA_STREAM);
+#if defined(WB32F3G71xx) || defined(WB32FQ95xx)
+    dmaStreamSetSource(WS2812_PWM_DMA_STREAM, buffer);
+#else
+    dmaStreamSetMemory0(WS2812_PWM_DMA_STREAM, buffer);
+#endif
+    dmaStreamSetTransactionSize(WS2812_PWM_DMA_STREAM, WS2812_BIT_N);
+    // Disabling the stream also disables its interrupts
+    dmaStreamSetMode(WS2812_PWM_DMA_STREAM, WS2812_PWM_DMA_MODE);
+    dmaStreamEnable(WS2812_PWM_DMA_STREAM);
+}
+
+// The last element written to the CCR is a reset bit, so the output stays low until the next frame starts
+static void ws2812_dma_callback(void* p, uint32_t flags) {
+    (void)p;
+    (void)flags;
+
+    osalSysLockFromISR();
+    if (ws2812_pending) {
+        ws2812_pending = false;
+        ws2812_front ^= 1;
+        ws2812_start_frame(ws2812_frame_buffer[ws2812_front]);
+    } else {
+        ws2812_sending = false;
+    }
+    osalSysUnlockFromISR();
+}
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 
 void ws2812_init(void) {
-    // Initialize led frame buffer
-    uint32_t i;
-    for (i = 0; i < WS2812_COLOR_BIT_N; i++)
-        ws2812_frame_buffer[i] = WS2812_DUTYCYCLE_0; // All color bits are zero duty cycle
-    for (i = 0; i < WS2812_RESET_BIT_N; i++)
-        ws2812_frame_buffer[i + WS2812_COLOR_BIT_N] = 0; // All reset bits are zero
+    // Initialize led frame buffers
+    for (uint8_t buffer = 0; buffer < WS2812_PWM_BUFFER_COUNT; buffer++) {
+        uint32_t i;
+        for (i = 0; i < WS2812_COLOR_BIT_N; i++)
+            ws2812_frame_buffer[buffer][i] = WS2812_DUTYCYCLE_0; // All color bits are zero duty cycle
+        for (i = 0; i < WS2812_RESET_BIT_N; i++)
+            ws2812_frame_buffer[buffer][i + WS2812_COLOR_BIT_N] = 0; // All reset bits are zero
+    }
 
     palSetLineMode(WS2812_DI_PIN, WS2812_OUTPUT_MODE);
 
@@ -338,26 +387,24 @@ void ws2812_init(void) {
     // Configure DMA
     // dmaInit(); // Joe added this
 #if defined(WB32F3G71xx) || defined(WB32FQ95xx)
-    dmaStreamAlloc(WS2812_PWM_DMA_STREAM - WB32_DMA_STREAM(0), 10, NULL, NULL);
-    dmaStreamSetSource(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer);
+    dmaStreamAlloc(WS2812_PWM_DMA_STREAM - WB32_DMA_STREAM(0), 10, ws2812_dma_callback, NULL);
+    dmaStreamSetSource(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer[0]);
     dmaStreamSetDestination(WS2812_PWM_DMA_STREAM, &(WS2812_PWM_DRIVER.tim->CCR[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
-    dmaStreamSetMode(WS2812_PWM_DMA_STREAM, WB32_DMA_CHCFG_HWHIF(WS2812_PWM_DMA_CHANNEL) | WB32_DMA_CHCFG_DIR_M2P | WB32_DMA_CHCFG_PSIZE_WORD | WB32_DMA_CHCFG_MSIZE_WORD | WB32_DMA_CHCFG_MINC | WB32_DMA_CHCFG_CIRC | WB32_DMA_CHCFG_TCIE | WB32_DMA_CHCFG_PL(3));
+    dmaStreamSetMode(WS2812_PWM_DMA_STREAM, WS2812_PWM_DMA_MODE);
 #else
-    dmaStreamAlloc(WS2812_PWM_DMA_STREAM - STM32_DMA_STREAM(0), 10, NULL, NULL);
+    dmaStreamAlloc(WS2812_PWM_DMA_STREAM - STM32_DMA_STREAM(0), 10, ws2812_dma_callback, NULL);
     dmaStreamSetPeripheral(WS2812_PWM_DMA_STREAM, &(WS2812_PWM_DRIVER.tim->CCR[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
-    dmaStreamSetMemory0(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer);
-    dmaStreamSetMode(WS2812_PWM_DMA_STREAM, STM32_DMA_CR_CHSEL(WS2812_PWM_DMA_CHANNEL) | STM32_DMA_CR_DIR_M2P | WS2812_PWM_DMA_PERIPHERAL_WIDTH | WS2812_PWM_DMA_MEMORY_WIDTH | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC | STM32_DMA_CR_PL(3));
+    dmaStreamSetMemory0(WS2812_PWM_DMA_STREAM, ws2812_frame_buffer[0]);
+    dmaStreamSetMode(WS2812_PWM_DMA_STREAM, WS2812_PWM_DMA_MODE);
 #endif
     dmaStreamSetTransactionSize(WS2812_PWM_DMA_STREAM, WS2812_BIT_N);
-    // M2P: Memory 2 Periph; PL: Priority Level
 
 #if (STM32_DMA_SUPPORTS_DMAMUX == TRUE)
     // If the MCU has a DMAMUX we need to assign the correct resource
     dmaSetRequestSource(WS2812_PWM_DMA_STREAM, WS2812_PWM_DMAMUX_ID);
 #endif
 
-    // Start DMA
-    dmaStreamEnable(WS2812_PWM_DMA_STREAM);
+    // The DMA is started by ws2812_setleds() for each frame
 
     // Configure PWM
     // NOTE: It's required that preload be enabled on the timer channel CCR register. This is currently enabled in the
@@ -367,33 +414,61 @@ void ws2812_init(void) {
     pwmEnableChannel(&WS2812_PWM_DRIVER, WS2812_PWM_CHANNEL - 1, 0); // Initial period is 0; output will be low until first duty cycle is DMA'd in
 }
 
-void ws2812_write_led(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b) {
+static inline void ws2812_write_led(ws2812_buffer_t* buffer, uint16_t led_number, uint8_t r, uint8_t g, uint8_t b) {
     // Write color to frame buffer
     for (uint8_t bit = 0; bit < 8; bit++) {
-        ws2812_frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
     }
 }
-void ws2812_write_led_rgbw(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+static inline void ws2812_write_led_rgbw(ws2812_buffer_t* buffer, uint16_t led_number, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
     // Write color to frame buffer
     for (uint8_t bit = 0; bit < 8; bit++) {
-        ws2812_frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
 #ifdef WS2812_RGBW
-        ws2812_frame_buffer[WS2812_WHITE_BIT(led_number, bit)] = ((w >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        buffer[WS2812_WHITE_BIT(led_number, bit)] = ((w >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
 #endif
     }
 }
 
+bool ws2812_busy(void) {
+    return ws2812_sending;
+}
+
 // Setleds for standard RGB
 void ws2812_setleds(rgb_led_t* ledarray, uint16_t leds) {
+#if WS2812_PWM_BUFFER_COUNT > 1
+    // A frame still waiting in the back buffer is replaced by this one
+    osalSysLock();
+    ws2812_pending = false;
+    uint8_t back   = ws2812_front ^ 1;
+    osalSysUnlock();
+#else
+    // Wait for the previous frame to be sent before overwriting it
+    while (ws2812_sending) {
+    }
+    uint8_t back = 0;
+#endif
+    ws2812_buffer_t* buffer = ws2812_frame_buffer[back];
+
     for (uint16_t i = 0; i < leds; i++) {
 #ifdef WS2812_RGBW
-        ws2812_write_led_rgbw(i, ledarray[i].r, ledarray[i].g, ledarray[i].b, ledarray[i].w);
+        ws2812_write_led_rgbw(buffer, i, ledarray[i].r, ledarray[i].g, ledarray[i].b, ledarray[i].w);
 #else
-        ws2812_write_led(i, ledarray[i].r, ledarray[i].g, ledarray[i].b);
+        ws2812_write_led(buffer, i, ledarray[i].r, ledarray[i].g, ledarray[i].b);
 #endif
     }
+
+    osalSysLock();
+    if (ws2812_sending) {
+        ws2812_pending = true;
+    } else {
+        ws2812_front   = back;
+        ws2812_sending = true;
+        ws2812_start_frame(buffer);
+    }
+    osalSysUnlock();
 }
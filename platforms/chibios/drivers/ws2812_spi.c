@@ -85,8 +85,27 @@
 #define DATA_SIZE (BYTES_FOR_LED * WS2812_LED_COUNT)
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
+#define TXBUF_SIZE (PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE)
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+// Unless sending synchronously or continuously, frames are sent in the background and the end of a transfer is
+// reported by the SPI callback. With a second buffer, the next frame is encoded while the previous one is sent.
+#if !defined(WS2812_SPI_USE_CIRCULAR_BUFFER) && !defined(WS2812_SPI_SYNC)
+#    define WS2812_SPI_ASYNC
+#    ifdef WS2812_DOUBLE_BUFFER
+#        define WS2812_SPI_BUFFER_COUNT 2
+#    endif
+#endif
+#ifndef WS2812_SPI_BUFFER_COUNT
+#    define WS2812_SPI_BUFFER_COUNT 1
+#endif
+
+static uint8_t txbuf[WS2812_SPI_BUFFER_COUNT][TXBUF_SIZE] = {0};
+
+#ifdef WS2812_SPI_ASYNC
+static volatile bool    ws2812_sending = false; // A transfer is in progress
+static volatile bool    ws2812_pending = false; // The buffer not being sent holds a frame, to be sent next
+static volatile uint8_t ws2812_front   = 0;     // The buffer being sent, or sent last
+#endif
 
 /*
  * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
@@ -106,8 +125,8 @@ static uint8_t get_protocol_eq(uint8_t data, int pos) {
     return eq;
 }
 
-static void set_led_color_rgb(rgb_led_t color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
+static void set_led_color_rgb(uint8_t* buffer, rgb_led_t color, int pos) {
+    uint8_t* tx_start = &buffer[PREAMBLE_SIZE];
 
 #if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
     for (int j = 0; j < 4; j++)
@@ -137,6 +156,23 @@ static void set_led_color_rgb(rgb_led_t color, int pos) {
 #endif
 }
 
+#ifdef WS2812_SPI_ASYNC
+static void ws2812_spi_end_cb(SPIDriver* spip) {
+    osalSysLockFromISR();
+    if (ws2812_pending) {
+        ws2812_pending = false;
+        ws2812_front ^= 1;
+        spiStartSendI(spip, TXBUF_SIZE, txbuf[ws2812_front]);
+    } else {
+        ws2812_sending = false;
+    }
+    osalSysUnlockFromISR();
+}
+#    define WS2812_SPI_END_CB ws2812_spi_end_cb
+#else
+#    define WS2812_SPI_END_CB NULL
+#endif
+
 void ws2812_init(void) {
     palSetLineMode(WS2812_DI_PIN, WS2812_MOSI_OUTPUT_MODE);
 
@@ -151,7 +187,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_CIRCULAR == TRUE
         WS2812_SPI_BUFFER_MODE,
 #    endif
-        NULL, // end_cb
+        WS2812_SPI_END_CB, // end_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
 #    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
@@ -170,7 +206,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_SLAVE_MODE == TRUE
         false,
 #    endif
-        NULL, // data_cb
+        WS2812_SPI_END_CB, // data_cb
         NULL, // error_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
@@ -183,22 +219,54 @@ void ws2812_init(void) {
     spiStart(&WS2812_SPI_DRIVER, &spicfg); /* Setup transfer parameters.       */
     spiSelect(&WS2812_SPI_DRIVER);         /* Slave Select assertion.          */
 #ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, txbuf[0]);
 #endif
 }
 
-void ws2812_setleds(rgb_led_t* ledarray, uint16_t leds) {
-    for (uint8_t i = 0; i < leds; i++) {
-        set_led_color_rgb(ledarray[i], i);
-    }
+bool ws2812_busy(void) {
+#ifdef WS2812_SPI_ASYNC
+    return ws2812_sending;
+#else
+    return false;
+#endif
+}
 
-    // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
-    // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
-#ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
-#    ifdef WS2812_SPI_SYNC
-    spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+void ws2812_setleds(rgb_led_t* ledarray, uint16_t leds) {
+#ifdef WS2812_SPI_ASYNC
+#    if WS2812_SPI_BUFFER_COUNT > 1
+    // A frame still waiting in the back buffer is replaced by this one
+    osalSysLock();
+    ws2812_pending = false;
+    uint8_t back   = ws2812_front ^ 1;
+    osalSysUnlock();
 #    else
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    // Wait for the previous frame to be sent before overwriting it
+    while (ws2812_sending) {
+    }
+    uint8_t back = 0;
 #    endif
+    uint8_t* buffer = txbuf[back];
+#else
+    uint8_t* buffer = txbuf[0];
+#endif
+
+    for (uint16_t i = 0; i < leds; i++) {
+        set_led_color_rgb(buffer, ledarray[i], i);
+    }
+
+    // Each led takes ~0.03ms, 50 leds ~1.5ms. Sending in the background lets the next frame be rendered meanwhile,
+    // spiSend can be used instead to send synchronously.
+#if defined(WS2812_SPI_ASYNC)
+    osalSysLock();
+    if (ws2812_sending) {
+        ws2812_pending = true;
+    } else {
+        ws2812_front   = back;
+        ws2812_sending = true;
+        spiStartSendI(&WS2812_SPI_DRIVER, TXBUF_SIZE, buffer);
+    }
+    osalSysUnlock();
+#elif defined(WS2812_SPI_SYNC)
+    spiSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, buffer);
 #endif
 }
@@ -0,0 +1,8 @@
+#include <stdio.h>
+#include <stdarg.h>
+void putchar_(char c);
+int vprintf_(const char *f, va_list a) { char b[512]; int n = vsnprintf(b, sizeof b, f, a); for (int i = 0; i < n && i < 511; i++) putchar_(b[i]); return n; }
+int printf_(const char *f, ...) { va_list a; va_start(a, f); int n = vprintf_(f, a); va_end(a); return n; }
+int vsnprintf_(char *s, size_t n, const char *f, va_list a) { return vsnprintf(s, n, f, a); }
+int snprintf_(char *s, size_t n, const char *f, ...) { va_list a; va_start(a, f); int r = vsnprintf(s, n, f, a); va_end(a); return r; }
+int sprintf_(char *s, const char *f, ...) { va_list a; va_start(a, f); int r = vsprintf(s, f, a); va_end(a); return r; }
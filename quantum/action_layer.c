@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -220,7 +221,16 @@ void layer_debug(void) {
 /** \brief source layer cache
  */
 
+#    ifdef SOURCE_LAYERS_CACHE_COMPACT
+/* Sized from the number of keymap layers, so it lives in keymap_introspection.c */
+extern uint8_t       source_layers_cache[];
+extern const uint8_t source_layers_cache_bits;
+#        ifdef SOURCE_LAYERS_CACHE_SPARSE
+extern const uint8_t matrix_key_index[MATRIX_ROWS][MATRIX_COLS] PROGMEM;
+#        endif
+#    else
 uint8_t source_layers_cache[((MATRIX_ROWS * MATRIX_COLS) + (CHAR_BIT)-1) / (CHAR_BIT)][MAX_LAYER_BITS] = {{0}};
+#    endif
 #    ifdef ENCODER_MAP_ENABLE
 uint8_t encoder_source_layers_cache[(NUM_ENCODERS + (CHAR_BIT)-1) / (CHAR_BIT)][MAX_LAYER_BITS] = {{0}};
 #    endif // ENCODER_MAP_ENABLE
@@ -253,14 +263,63 @@ uint8_t read_source_layers_cache_impl(uint16_t entry_number, uint8_t cache[][MAX
     return layer;
 }
 
+#    ifdef SOURCE_LAYERS_CACHE_COMPACT
+/** \brief compact source layers cache entry
+ *
+ * Returns the cache entry for a key. Matrix positions no layout uses all share the last entry.
+ */
+static uint16_t compact_source_layers_cache_entry(keypos_t key) {
+#        ifdef SOURCE_LAYERS_CACHE_SPARSE
+    const uint8_t entry_number = pgm_read_byte(&matrix_key_index[key.row][key.col]);
+    return entry_number < MATRIX_KEY_COUNT ? entry_number : MATRIX_KEY_COUNT;
+#        else
+    return (uint16_t)(key.row * MATRIX_COLS) + key.col;
+#        endif
+}
+
+/** \brief update compact source layers cache
+ *
+ * Entries are packed back to back, source_layers_cache_bits wide each
+ */
+static void update_compact_source_layers_cache(keypos_t key, uint8_t layer) {
+    uint16_t bit_index = compact_source_layers_cache_entry(key) * source_layers_cache_bits;
+    for (uint8_t bit_number = 0; bit_number < source_layers_cache_bits; bit_number++, bit_index++) {
+        const uint8_t storage_bit = 1U << (bit_index % (CHAR_BIT));
+        if (layer & (1U << bit_number)) {
+            source_layers_cache[bit_index / (CHAR_BIT)] |= storage_bit;
+        } else {
+            source_layers_cache[bit_index / (CHAR_BIT)] &= ~storage_bit;
+        }
+    }
+}
+
+/** \brief read compact source layers cache
+ *
+ * Reads back the layer stored when the key was pressed
+ */
+static uint8_t read_compact_source_layers_cache(keypos_t key) {
+    uint16_t bit_index = compact_source_layers_cache_entry(key) * source_layers_cache_bits;
+    uint8_t  layer     = 0;
+    for (uint8_t bit_number = 0; bit_number < source_layers_cache_bits; bit_number++, bit_index++) {
+        layer |= ((source_layers_cache[bit_index / (CHAR_BIT)] & (1U << (bit_index % (CHAR_BIT)))) != 0) << bit_number;
+    }
+
+    return layer;
+}
+#    endif // SOURCE_LAYERS_CACHE_COMPACT
+
 /** \brief update encoder source layers cache
  *
  * Updates the cached encoders when changing layers
  */
 void update_source_layers_cache(keypos_t key, uint8_t layer) {
     if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+#    ifdef SOURCE_LAYERS_CACHE_COMPACT
+        update_compact_source_layers_cache(key, layer);
+#    else
         const uint16_t entry_number = (uint16_t)(key.row * MATRIX_COLS) + key.col;
         update_source_layers_cache_impl(layer, entry_number, source_layers_cache);
+#    endif
     }
 #    ifdef ENCODER_MAP_ENABLE
     else if (key.row == KEYLOC_ENCODER_CW || key.row == KEYLOC_ENCODER_CCW) {
@@ -276,8 +335,12 @@ void update_source_layers_cache(keypos_t key, uint8_t layer) {
  */
 uint8_t read_source_layers_cache(keypos_t key) {
     if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+#    ifdef SOURCE_LAYERS_CACHE_COMPACT
+        return read_compact_source_layers_cache(key);
+#    else
         const uint16_t entry_number = (uint16_t)(key.row * MATRIX_COLS) + key.col;
         return read_source_layers_cache_impl(entry_number, source_layers_cache);
+#    endif
     }
 #    ifdef ENCODER_MAP_ENABLE
     else if (key.row == KEYLOC_ENCODER_CW || key.row == KEYLOC_ENCODER_CCW) {
@@ -316,16 +379,15 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
-/** \brief Layer switch get layer
+#ifndef NO_ACTION_LAYER
+/** \brief Layer search
  *
- * Gets the layer based on key info
+ * Walks the active layers from the top down and returns the first one where the key is not transparent
  */
-uint8_t layer_switch_get_layer(keypos_t key) {
-#ifndef NO_ACTION_LAYER
+static uint8_t layer_search(keypos_t key, layer_state_t layers) {
     action_t action;
     action.code = ACTION_TRANSPARENT;
 
-    layer_state_t layers = layer_state | default_layer_state;
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
@@ -337,6 +399,58 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     }
     /* fall back to layer 0 */
     return 0;
+}
+
+#    ifdef LAYER_LOOKUP_CACHE
+/** \brief layer lookup cache
+ *
+ * Resolved layer for each matrix position under layer_lookup_cache_state. Entries are
+ * filled on first lookup and all of them are dropped whenever the layer state changes.
+ */
+static uint8_t       layer_lookup_cache[MATRIX_ROWS * MATRIX_COLS];
+static uint8_t       layer_lookup_cache_valid[((MATRIX_ROWS * MATRIX_COLS) + (CHAR_BIT)-1) / (CHAR_BIT)];
+static layer_state_t layer_lookup_cache_state;
+
+/** \brief Layer lookup cache clear
+ *
+ * Drops every cached lookup, call this whenever the keymap itself changes
+ */
+void layer_lookup_cache_clear(void) {
+    memset(layer_lookup_cache_valid, 0, sizeof(layer_lookup_cache_valid));
+}
+
+static uint8_t layer_lookup_cache_get(keypos_t key, layer_state_t layers) {
+    if (layers != layer_lookup_cache_state) {
+        layer_lookup_cache_clear();
+        layer_lookup_cache_state = layers;
+    }
+
+    const uint16_t entry_number = (uint16_t)(key.row * MATRIX_COLS) + key.col;
+    const uint16_t storage_idx  = entry_number / (CHAR_BIT);
+    const uint8_t  storage_bit  = 1U << (entry_number % (CHAR_BIT));
+
+    if (!(layer_lookup_cache_valid[storage_idx] & storage_bit)) {
+        layer_lookup_cache[entry_number] = layer_search(key, layers);
+        layer_lookup_cache_valid[storage_idx] |= storage_bit;
+    }
+    return layer_lookup_cache[entry_number];
+}
+#    endif
+#endif
+
+/** \brief Layer switch get layer
+ *
+ * Gets the layer based on key info
+ */
+uint8_t layer_switch_get_layer(keypos_t key) {
+#ifndef NO_ACTION_LAYER
+    layer_state_t layers = layer_state | default_layer_state;
+#    ifdef LAYER_LOOKUP_CACHE
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        return layer_lookup_cache_get(key, layers);
+    }
+#    endif
+    return layer_search(key, layers);
 #else
     return get_highest_layer(default_layer_state);
 #endif
@@ -157,6 +157,15 @@ layer_state_t update_tri_layer_state(layer_state_t state, uint8_t layer1, uint8_
 
 /* pressed actions cache */
 #if !defined(NO_ACTION_LAYER) && !defined(STRICT_LAYER_RELEASE)
+#    ifdef SOURCE_LAYERS_CACHE_COMPACT
+#        if defined(MATRIX_KEY_COUNT) && (MATRIX_KEY_COUNT < 255)
+/* only matrix positions used by a layout get their own entry, see matrix_key_index, the rest share one more */
+#            define SOURCE_LAYERS_CACHE_SPARSE
+#            define SOURCE_LAYERS_CACHE_KEYS ((MATRIX_KEY_COUNT) + 1)
+#        else
+#            define SOURCE_LAYERS_CACHE_KEYS (MATRIX_ROWS * MATRIX_COLS)
+#        endif
+#    endif
 
 void    update_source_layers_cache(keypos_t key, uint8_t layer);
 uint8_t read_source_layers_cache(keypos_t key);
@@ -166,5 +175,10 @@ action_t store_or_get_action(bool pressed, keypos_t key);
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+/* forget cached layer lookups, needed when keycodes in the keymap change at runtime */
+void layer_lookup_cache_clear(void);
+#endif
+
 /* return action depending on current layer status */
 action_t layer_switch_get_action(keypos_t key);
@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "action.h"
 #include "action_layer.h"
@@ -59,13 +60,27 @@ __attribute__((weak)) bool get_hold_on_other_key_press(uint16_t keycode, keyreco
 #        include "process_auto_shift.h"
 #    endif
 
-static keyrecord_t tapping_key                         = {};
-static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
-static uint8_t     waiting_buffer_head                 = 0;
-static uint8_t     waiting_buffer_tail                 = 0;
+_Static_assert(WAITING_BUFFER_SIZE <= 128 && (WAITING_BUFFER_SIZE & (WAITING_BUFFER_SIZE - 1)) == 0, "WAITING_BUFFER_SIZE must be a power of two, up to 128");
+
+#    define WAITING_BUFFER_MASK (WAITING_BUFFER_SIZE - 1)
+#    define WAITING_BUFFER_NONE 0xFF
+
+/* The waiting buffer is a ring of records in the order they arrived. The records are also chained by
+ * key position: each bucket holds the oldest and newest buffered record of the keys hashed to it, and
+ * waiting_buffer_next links a record to the next one in its bucket. Records only ever leave from the
+ * tail, so the oldest record of a bucket is always the first of that bucket to go.
+ */
+static keyrecord_t tapping_key                                      = {};
+static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE]              = {};
+static uint8_t     waiting_buffer_next[WAITING_BUFFER_SIZE]         = {};
+static uint8_t     waiting_buffer_bucket_first[WAITING_BUFFER_SIZE] = {[0 ... WAITING_BUFFER_MASK] = WAITING_BUFFER_NONE};
+static uint8_t     waiting_buffer_bucket_last[WAITING_BUFFER_SIZE]  = {};
+static uint8_t     waiting_buffer_head                              = 0;
+static uint8_t     waiting_buffer_tail                              = 0;
 
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
+static void waiting_buffer_deq(void);
 static void waiting_buffer_clear(void);
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
@@ -98,7 +113,7 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_deq()) {
         if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
             debug_record(waiting_buffer[waiting_buffer_tail]);
@@ -432,6 +447,10 @@ bool process_tapping(keyrecord_t *keyp) {
     }
 }
 
+static inline uint8_t waiting_buffer_bucket(keypos_t key) {
+    return (key.row * 7 + key.col) & WAITING_BUFFER_MASK;
+}
+
 /** \brief Waiting buffer enq
  *
  * FIXME: Needs docs
@@ -441,19 +460,40 @@ bool waiting_buffer_enq(keyrecord_t record) {
         return true;
     }
 
-    if ((waiting_buffer_head + 1) % WAITING_BUFFER_SIZE == waiting_buffer_tail) {
+    if (((waiting_buffer_head + 1) & WAITING_BUFFER_MASK) == waiting_buffer_tail) {
         ac_dprintf("waiting_buffer_enq: Over flow.\n");
         return false;
     }
 
-    waiting_buffer[waiting_buffer_head] = record;
-    waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
+    uint8_t slot   = waiting_buffer_head;
+    uint8_t bucket = waiting_buffer_bucket(record.event.key);
+
+    waiting_buffer[slot]      = record;
+    waiting_buffer_next[slot] = WAITING_BUFFER_NONE;
+    if (waiting_buffer_bucket_first[bucket] == WAITING_BUFFER_NONE) {
+        waiting_buffer_bucket_first[bucket] = slot;
+    } else {
+        waiting_buffer_next[waiting_buffer_bucket_last[bucket]] = slot;
+    }
+    waiting_buffer_bucket_last[bucket] = slot;
+    waiting_buffer_head                = (slot + 1) & WAITING_BUFFER_MASK;
 
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
     return true;
 }
 
+/** \brief Waiting buffer deq
+ *
+ * Drops the oldest record, once it has been processed.
+ */
+void waiting_buffer_deq(void) {
+    uint8_t slot = waiting_buffer_tail;
+
+    waiting_buffer_bucket_first[waiting_buffer_bucket(waiting_buffer[slot].event.key)] = waiting_buffer_next[slot];
+    waiting_buffer_tail                                                                 = (slot + 1) & WAITING_BUFFER_MASK;
+}
+
 /** \brief Waiting buffer clear
  *
  * FIXME: Needs docs
@@ -461,6 +501,7 @@ bool waiting_buffer_enq(keyrecord_t record) {
 void waiting_buffer_clear(void) {
     waiting_buffer_head = 0;
     waiting_buffer_tail = 0;
+    memset(waiting_buffer_bucket_first, WAITING_BUFFER_NONE, sizeof(waiting_buffer_bucket_first));
 }
 
 /** \brief Waiting buffer typed
@@ -468,7 +509,7 @@ void waiting_buffer_clear(void) {
  * FIXME: Needs docs
  */
 bool waiting_buffer_typed(keyevent_t event) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_bucket_first[waiting_buffer_bucket(event.key)]; i != WAITING_BUFFER_NONE; i = waiting_buffer_next[i]) {
         if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
             return true;
         }
@@ -481,7 +522,7 @@ bool waiting_buffer_typed(keyevent_t event) {
  * FIXME: Needs docs
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) & WAITING_BUFFER_MASK) {
         if (waiting_buffer[i].event.pressed) return true;
     }
     return false;
@@ -502,7 +543,7 @@ void waiting_buffer_scan_tap(void) {
 #    if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
     TAP_DEFINE_KEYCODE;
 #    endif
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_bucket_first[waiting_buffer_bucket(tapping_key.event.key)]; i != WAITING_BUFFER_NONE; i = waiting_buffer_next[i]) {
         keyrecord_t *candidate = &waiting_buffer[i];
         // clang-format off
         if (IS_EVENT(candidate->event) && KEYEQ(candidate->event.key, tapping_key.event.key) && !candidate->event.pressed && (
@@ -536,7 +577,7 @@ static void debug_tapping_key(void) {
  */
 static void debug_waiting_buffer(void) {
     ac_dprintf("{ ");
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) & WAITING_BUFFER_MASK) {
         ac_dprintf("[%u]=", i);
         debug_record(waiting_buffer[i]);
         ac_dprintf(" ");
@@ -283,13 +283,21 @@ static uint8_t get_mods_for_report(void) {
 }
 
 void send_6kro_report(void) {
-    keyboard_report->mods = get_mods_for_report();
+    uint8_t mods         = get_mods_for_report();
+    bool    keys_changed = report_keys_changed();
 
 #ifdef PROTOCOL_VUSB
+    keyboard_report->mods = mods;
     host_keyboard_send(keyboard_report);
 #else
     static report_keyboard_t last_report;
 
+    /* Neither the keys nor the mods moved, so there is nothing to compare. */
+    if (!keys_changed && mods == last_report.mods) {
+        return;
+    }
+    keyboard_report->mods = mods;
+
     /* Only send the report if there are changes to propagate to the host. */
     if (memcmp(keyboard_report, &last_report, sizeof(report_keyboard_t)) != 0) {
         memcpy(&last_report, keyboard_report, sizeof(report_keyboard_t));
@@ -300,10 +308,17 @@ void send_6kro_report(void) {
 
 #ifdef NKRO_ENABLE
 void send_nkro_report(void) {
-    nkro_report->mods = get_mods_for_report();
+    uint8_t mods         = get_mods_for_report();
+    bool    keys_changed = report_keys_changed();
 
     static report_nkro_t last_report;
 
+    /* Neither the keys nor the mods moved, so there is nothing to compare. */
+    if (!keys_changed && mods == last_report.mods) {
+        return;
+    }
+    nkro_report->mods = mods;
+
     /* Only send the report if there are changes to propagate to the host. */
     if (memcmp(nkro_report, &last_report, sizeof(report_nkro_t)) != 0) {
         memcpy(&last_report, nkro_report, sizeof(report_nkro_t));
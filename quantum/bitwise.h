@@ -35,6 +35,51 @@ uint8_t  bitrev(uint8_t bits);
 uint16_t bitrev16(uint16_t bits);
 uint32_t bitrev32(uint32_t bits);
 
+// least significant on-bit - return lowest location of on-bit (count trailing zeros)
+// NOTE: return 0 when bit0 is on or all bits are off
+// inline, as these sit on the matrix scan path; AVR has no hardware instruction, so avoid the libgcc helper
+static inline uint8_t bitctz(uint8_t bits) {
+#if defined(__AVR__)
+    uint8_t n = 0;
+    if (!(bits & 0x0F)) {
+        bits >>= 4;
+        n += 4;
+    }
+    if (!(bits & 0x03)) {
+        bits >>= 2;
+        n += 2;
+    }
+    if (!(bits & 0x01)) {
+        n += 1;
+    }
+    return bits ? n : 0;
+#else
+    return bits ? __builtin_ctz(bits) : 0;
+#endif
+}
+
+static inline uint8_t bitctz16(uint16_t bits) {
+#if defined(__AVR__)
+    if (!(bits & 0x00FF)) {
+        return bitctz(bits >> 8) + ((bits >> 8) ? 8 : 0);
+    }
+    return bitctz(bits);
+#else
+    return bits ? __builtin_ctz(bits) : 0;
+#endif
+}
+
+static inline uint8_t bitctz32(uint32_t bits) {
+#if defined(__AVR__)
+    if (!(bits & 0x0000FFFF)) {
+        return bitctz16(bits >> 16) + ((bits >> 16) ? 16 : 0);
+    }
+    return bitctz16(bits);
+#else
+    return bits ? __builtin_ctzl(bits) : 0;
+#endif
+}
+
 #ifdef __cplusplus
 }
 #endif
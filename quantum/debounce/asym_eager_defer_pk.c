@@ -43,39 +43,31 @@ releasing a key, that state is pushed after no changes occur for DEBOUNCE millis
 #    define DEBOUNCE 127
 #endif
 
-#define ROW_SHIFTER ((matrix_row_t)1)
-
-typedef struct {
-    bool    pressed : 1;
-    uint8_t time : 7;
-} debounce_counter_t;
+#include "vertical_counters.h"
 
 #if DEBOUNCE > 0
-static debounce_counter_t *debounce_counters;
-static fast_timer_t        last_time;
-static bool                counters_need_update;
-static bool                matrix_need_update;
-static bool                cooked_changed;
-
-#    define DEBOUNCE_ELAPSED 0
+static debounce_counter_row_t *debounce_counters;
+// Keys whose counter was started by a key-down
+static matrix_row_t   *debounce_pressed;
+static fast_timer_t    last_time;
+static bool            counters_need_update;
+static bool            matrix_need_update;
+static bool            cooked_changed;
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
 static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
 void debounce_init(uint8_t num_rows) {
-    debounce_counters = malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
-    int i             = 0;
-    for (uint8_t r = 0; r < num_rows; r++) {
-        for (uint8_t c = 0; c < MATRIX_COLS; c++) {
-            debounce_counters[i++].time = DEBOUNCE_ELAPSED;
-        }
-    }
+    debounce_counters = (debounce_counter_row_t *)calloc(num_rows, sizeof(debounce_counter_row_t));
+    debounce_pressed  = (matrix_row_t *)calloc(num_rows, sizeof(matrix_row_t));
 }
 
 void debounce_free(void) {
     free(debounce_counters);
     debounce_counters = NULL;
+    free(debounce_pressed);
+    debounce_pressed = NULL;
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
@@ -109,67 +101,59 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 }
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
-
     counters_need_update = false;
     matrix_need_update   = false;
 
     for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            matrix_row_t col_mask = (ROW_SHIFTER << col);
-
-            if (debounce_pointer->time != DEBOUNCE_ELAPSED) {
-                if (debounce_pointer->time <= elapsed_time) {
-                    debounce_pointer->time = DEBOUNCE_ELAPSED;
-
-                    if (debounce_pointer->pressed) {
-                        // key-down: eager
-                        matrix_need_update = true;
-                    } else {
-                        // key-up: defer
-                        matrix_row_t cooked_next = (cooked[row] & ~col_mask) | (raw[row] & col_mask);
-                        cooked_changed |= cooked_next ^ cooked[row];
-                        cooked[row] = cooked_next;
-                    }
-                } else {
-                    debounce_pointer->time -= elapsed_time;
-                    counters_need_update = true;
-                }
-            }
-            debounce_pointer++;
+        matrix_row_t running = debounce_counters_running(&debounce_counters[row]);
+        if (!running) {
+            continue;
+        }
+
+        matrix_row_t expired = debounce_counters_elapse(&debounce_counters[row], running, elapsed_time);
+        if (expired & debounce_pressed[row]) {
+            // key-down: eager
+            matrix_need_update = true;
+        }
+
+        matrix_row_t released = expired & ~debounce_pressed[row];
+        if (released) {
+            // key-up: defer
+            matrix_row_t cooked_next = (cooked[row] & ~released) | (raw[row] & released);
+            cooked_changed |= cooked_next ^ cooked[row];
+            cooked[row] = cooked_next;
+        }
+
+        if (running & ~expired) {
+            counters_need_update = true;
         }
     }
 }
 
 static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
-
     matrix_need_update = false;
 
     for (uint8_t row = 0; row < num_rows; row++) {
-        matrix_row_t delta = raw[row] ^ cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            matrix_row_t col_mask = (ROW_SHIFTER << col);
-
-            if (delta & col_mask) {
-                if (debounce_pointer->time == DEBOUNCE_ELAPSED) {
-                    debounce_pointer->pressed = (raw[row] & col_mask);
-                    debounce_pointer->time    = DEBOUNCE;
-                    counters_need_update      = true;
-
-                    if (debounce_pointer->pressed) {
-                        // key-down: eager
-                        cooked[row] ^= col_mask;
-                        cooked_changed = true;
-                    }
-                }
-            } else if (debounce_pointer->time != DEBOUNCE_ELAPSED) {
-                if (!debounce_pointer->pressed) {
-                    // key-up: defer
-                    debounce_pointer->time = DEBOUNCE_ELAPSED;
-                }
+        matrix_row_t delta   = raw[row] ^ cooked[row];
+        matrix_row_t running = debounce_counters_running(&debounce_counters[row]);
+        matrix_row_t started = delta & ~running;
+
+        if (started) {
+            debounce_pressed[row] = (debounce_pressed[row] & ~started) | (raw[row] & started);
+            debounce_counters_start(&debounce_counters[row], started);
+            counters_need_update = true;
+
+            if (raw[row] & started) {
+                // key-down: eager
+                cooked[row] ^= raw[row] & started;
+                cooked_changed = true;
             }
-            debounce_pointer++;
+        }
+
+        // key-up: defer
+        matrix_row_t settled = running & ~delta & ~debounce_pressed[row];
+        if (settled) {
+            debounce_counters_stop(&debounce_counters[row], settled);
         }
     }
 }
@@ -0,0 +1,132 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+extern "C" {
+#include "debounce.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+struct BenchmarkKey {
+    uint8_t  row;
+    uint8_t  col;
+    uint32_t pressed;
+    uint32_t released;
+};
+
+class DebounceBenchmark : public ::testing::Test {
+   protected:
+    matrix_row_t raw_[MATRIX_ROWS]    = {};
+    matrix_row_t cooked_[MATRIX_ROWS] = {};
+
+    // Presses random keys at a steady pace, every press and release bouncing for a few milliseconds
+    std::vector<BenchmarkKey> typing(uint32_t scans, uint32_t interval, uint32_t dwell) {
+        std::vector<BenchmarkKey> keys;
+        uint32_t                  seed = 1;
+        for (uint32_t time = 10; interval > 0 && time + dwell + 10 < scans; time += interval) {
+            seed = seed * 1103515245 + 12345;
+            keys.push_back({(uint8_t)((seed >> 16) % MATRIX_ROWS), (uint8_t)((seed >> 8) % MATRIX_COLS), time, time + dwell});
+        }
+        return keys;
+    }
+
+    bool raw_state(const std::vector<BenchmarkKey> &keys, size_t first, uint8_t row, uint8_t col, uint32_t now) {
+        bool pressed = false;
+        for (size_t i = first; i < keys.size() && keys[i].pressed <= now; i++) {
+            const BenchmarkKey &key = keys[i];
+            if (key.row != row || key.col != col) {
+                continue;
+            }
+            // Contacts chatter for the first 3ms after each edge
+            if (now < key.pressed + 3) {
+                pressed = (now - key.pressed) % 2 == 0;
+            } else if (now < key.released) {
+                pressed = true;
+            } else {
+                pressed = now < key.released + 3 && (now - key.released) % 2 == 1;
+            }
+        }
+        return pressed;
+    }
+
+    // Returns the time spent in debounce() per scan, in nanoseconds
+    double run(const std::vector<BenchmarkKey> &keys, uint32_t scans, unsigned *presses) {
+        debounce_init(MATRIX_ROWS);
+        set_time(1000);
+        std::fill(std::begin(raw_), std::end(raw_), 0);
+        std::fill(std::begin(cooked_), std::end(cooked_), 0);
+
+        std::vector<matrix_row_t> previous(MATRIX_ROWS, 0);
+        std::chrono::nanoseconds  spent(0);
+        size_t                    first = 0;
+        *presses                        = 0;
+
+        for (uint32_t now = 0; now < scans; now++) {
+            while (first < keys.size() && keys[first].released + 3 < now) {
+                first++;
+            }
+
+            matrix_row_t next[MATRIX_ROWS] = {};
+            for (size_t i = first; i < keys.size() && keys[i].pressed <= now; i++) {
+                if (raw_state(keys, first, keys[i].row, keys[i].col, now)) {
+                    next[keys[i].row] |= (matrix_row_t)1 << keys[i].col;
+                }
+            }
+            bool changed = !std::equal(std::begin(next), std::end(next), std::begin(raw_));
+            std::copy(std::begin(next), std::end(next), std::begin(raw_));
+
+            auto start = std::chrono::steady_clock::now();
+            debounce(raw_, cooked_, MATRIX_ROWS, changed);
+            spent += std::chrono::steady_clock::now() - start;
+
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                *presses += __builtin_popcount(cooked_[row] & ~previous[row]);
+                previous[row] = cooked_[row];
+            }
+            advance_time(1);
+        }
+
+        debounce_free();
+
+        // Take off the time it takes to read the clock twice
+        for (uint32_t i = 0; i < scans; i++) {
+            auto before = std::chrono::steady_clock::now();
+            spent -= std::chrono::steady_clock::now() - before;
+        }
+        return std::max(0.0, (double)spent.count() / scans);
+    }
+};
+
+TEST_F(DebounceBenchmark, ScanTime) {
+    const uint32_t scans = 100000;
+
+    struct {
+        const char *name;
+        uint32_t    interval;
+        uint32_t    dwell;
+    } loads[] = {
+        {"idle", 0, 0},
+        {"typing", 60, 80},
+        {"rollover", 15, 60},
+    };
+
+    for (const auto &load : loads) {
+        std::vector<BenchmarkKey> keys = typing(scans, load.interval, load.dwell);
+        unsigned                  presses;
+        double                    ns_per_scan = run(keys, scans, &presses);
+
+        // A press can be lost when the same key comes up again while it is still held, but never duplicated
+        EXPECT_LE(presses, keys.size());
+        EXPECT_GE(presses, keys.size() * 9 / 10);
+        printf("[ BENCH    ] %ux%u matrix, %-8s %6u presses %7.1f ns/scan\n", MATRIX_ROWS, MATRIX_COLS, load.name, presses, ns_per_scan);
+    }
+}
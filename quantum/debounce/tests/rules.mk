@@ -52,3 +52,21 @@ debounce_asym_eager_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_asym_eager_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp
+
+# Scan time of the per-key algorithms on a 128 key matrix
+DEBOUNCE_BENCHMARK_DEFS := -DMATRIX_ROWS=8 -DMATRIX_COLS=16 -DDEBOUNCE=5
+
+debounce_sym_defer_pk_benchmark_DEFS := $(DEBOUNCE_BENCHMARK_DEFS)
+debounce_sym_defer_pk_benchmark_SRC := $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark_tests.cpp
+
+debounce_sym_eager_pk_benchmark_DEFS := $(DEBOUNCE_BENCHMARK_DEFS)
+debounce_sym_eager_pk_benchmark_SRC := $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/debounce/sym_eager_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark_tests.cpp
+
+debounce_asym_eager_defer_pk_benchmark_DEFS := $(DEBOUNCE_BENCHMARK_DEFS)
+debounce_asym_eager_defer_pk_benchmark_SRC := $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark_tests.cpp
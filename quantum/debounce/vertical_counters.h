@@ -0,0 +1,97 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Vertical (bit-sliced) debounce counters, shared by the per-key algorithms.
+
+Each key has a countdown of up to DEBOUNCE milliseconds, but instead of a byte per key, bit N of every counter in a
+row is stored in plane N of that row. Starting, clearing and counting down works on a whole matrix_row_t at once, so
+a row costs the same handful of operations whether it has one key or 32, and rows with no running counter are
+skipped with a single test.
+
+A counter of 0 is not running. Include this after DEBOUNCE has been clamped to its maximum.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "matrix.h"
+
+#if DEBOUNCE > 127
+#    define DEBOUNCE_COUNTER_BITS 8
+#elif DEBOUNCE > 63
+#    define DEBOUNCE_COUNTER_BITS 7
+#elif DEBOUNCE > 31
+#    define DEBOUNCE_COUNTER_BITS 6
+#elif DEBOUNCE > 15
+#    define DEBOUNCE_COUNTER_BITS 5
+#elif DEBOUNCE > 7
+#    define DEBOUNCE_COUNTER_BITS 4
+#elif DEBOUNCE > 3
+#    define DEBOUNCE_COUNTER_BITS 3
+#elif DEBOUNCE > 1
+#    define DEBOUNCE_COUNTER_BITS 2
+#else
+#    define DEBOUNCE_COUNTER_BITS 1
+#endif
+
+typedef struct {
+    matrix_row_t bits[DEBOUNCE_COUNTER_BITS];
+} debounce_counter_row_t;
+
+// Keys whose counter is running
+static inline matrix_row_t debounce_counters_running(const debounce_counter_row_t *counters) {
+    matrix_row_t running = 0;
+    for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+        running |= counters->bits[bit];
+    }
+    return running;
+}
+
+// Sets the counters of the keys in mask to DEBOUNCE
+static inline void debounce_counters_start(debounce_counter_row_t *counters, matrix_row_t mask) {
+    for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+        if ((DEBOUNCE >> bit) & 1) {
+            counters->bits[bit] |= mask;
+        } else {
+            counters->bits[bit] &= ~mask;
+        }
+    }
+}
+
+// Stops the counters of the keys in mask
+static inline void debounce_counters_stop(debounce_counter_row_t *counters, matrix_row_t mask) {
+    for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+        counters->bits[bit] &= ~mask;
+    }
+}
+
+/**
+ * Counts every running counter down by elapsed_time, stopping those that reach 0.
+ *
+ * @return The keys whose counter expired
+ */
+static inline matrix_row_t debounce_counters_elapse(debounce_counter_row_t *counters, matrix_row_t running, uint8_t elapsed_time) {
+    if (elapsed_time >= (1 << DEBOUNCE_COUNTER_BITS) - 1) {
+        debounce_counters_stop(counters, running);
+        return running;
+    }
+
+    // Ripple-borrow subtraction of the same constant from every counter in the row
+    matrix_row_t borrow    = 0;
+    matrix_row_t remaining = 0;
+    for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+        matrix_row_t counter  = counters->bits[bit];
+        matrix_row_t subtract = ((elapsed_time >> bit) & 1) ? ~(matrix_row_t)0 : 0;
+        matrix_row_t diff     = counter ^ subtract ^ borrow;
+
+        borrow              = (~counter & (subtract | borrow)) | (counter & subtract & borrow);
+        counters->bits[bit] = diff;
+        remaining |= diff;
+    }
+
+    // Counters that went below zero or landed on it have expired
+    matrix_row_t expired = running & (borrow | ~remaining);
+    debounce_counters_stop(counters, expired | ~running);
+    return expired;
+}
@@ -12,14 +12,17 @@
 //------------------------------------
 // Helpers
 //
+// Each table is kept as a binary min-heap ordered by trigger time, with the in-use entries packed at the front. The
+// next executor to fire is always table[0], so checking for due executors costs the same however many are queued.
+//
 
 static deferred_token current_token = 0;
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
+static inline bool token_can_be_used(deferred_executor_t *table, size_t used_count, deferred_token token) {
     if (token == INVALID_DEFERRED_TOKEN) {
         return false;
     }
-    for (int i = 0; i < table_count; ++i) {
+    for (int i = 0; i < used_count; ++i) {
         if (table[i].token == token) {
             return false;
         }
@@ -27,9 +30,9 @@ static inline bool token_can_be_used(deferred_executor_t *table, size_t table_co
     return true;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
+static inline deferred_token allocate_token(deferred_executor_t *table, size_t used_count) {
     deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
+    while (!token_can_be_used(table, used_count, current_token)) {
         ++current_token;
         if (current_token == first) {
             // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
@@ -39,6 +42,91 @@ static inline deferred_token allocate_token(deferred_executor_t *table, size_t t
     return current_token;
 }
 
+// Number of in-use entries -- they're packed at the front of the table, so the boundary can be found with a binary search
+static size_t used_entries(deferred_executor_t *table, size_t table_count) {
+    size_t lo = 0;
+    size_t hi = table_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (table[mid].token != INVALID_DEFERRED_TOKEN) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static inline bool fires_before(const deferred_executor_t *a, const deferred_executor_t *b) {
+    return ((int32_t)TIMER_DIFF_32(a->trigger_time, b->trigger_time)) < 0;
+}
+
+static inline void swap_entries(deferred_executor_t *table, size_t a, size_t b) {
+    deferred_executor_t tmp = table[a];
+    table[a]                = table[b];
+    table[b]                = tmp;
+}
+
+static size_t sift_up(deferred_executor_t *table, size_t index) {
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!fires_before(&table[index], &table[parent])) {
+            break;
+        }
+        swap_entries(table, index, parent);
+        index = parent;
+    }
+    return index;
+}
+
+static void sift_down(deferred_executor_t *table, size_t used_count, size_t index) {
+    while (true) {
+        size_t earliest = index;
+        size_t left     = 2 * index + 1;
+        size_t right    = left + 1;
+        if (left < used_count && fires_before(&table[left], &table[earliest])) {
+            earliest = left;
+        }
+        if (right < used_count && fires_before(&table[right], &table[earliest])) {
+            earliest = right;
+        }
+        if (earliest == index) {
+            break;
+        }
+        swap_entries(table, index, earliest);
+        index = earliest;
+    }
+}
+
+// Restores the heap after the trigger time of the entry at index has changed
+static inline void reschedule_entry(deferred_executor_t *table, size_t used_count, size_t index) {
+    sift_down(table, used_count, sift_up(table, index));
+}
+
+static void remove_entry(deferred_executor_t *table, size_t used_count, size_t index) {
+    size_t last = used_count - 1;
+    if (index != last) {
+        table[index] = table[last];
+    }
+    table[last].token        = INVALID_DEFERRED_TOKEN;
+    table[last].trigger_time = 0;
+    table[last].callback     = NULL;
+    table[last].cb_arg       = NULL;
+    if (index != last) {
+        reschedule_entry(table, last, index);
+    }
+}
+
+// Returns the index of the entry holding the token, or used_count if there is none
+static size_t find_entry(deferred_executor_t *table, size_t used_count, deferred_token token) {
+    for (size_t i = 0; i < used_count; ++i) {
+        if (table[i].token == token) {
+            return i;
+        }
+    }
+    return used_count;
+}
+
 //------------------------------------
 // Advanced API: used when a custom-allocated table is used, primarily for core code.
 //
@@ -49,27 +137,26 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
+    // Claim the first unused slot, if there's one available
+    size_t used_count = used_entries(table, table_count);
+    if (used_count == table_count) {
+        return INVALID_DEFERRED_TOKEN;
+    }
 
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Work out the new token value, dropping out if none were available
+    deferred_token token = allocate_token(table, used_count);
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Set up the executor table entry, then move it to its place in the queue
+    deferred_executor_t *entry = &table[used_count];
+    entry->token               = token;
+    entry->trigger_time        = timer_read32() + delay_ms;
+    entry->callback            = callback;
+    entry->cb_arg              = cb_arg;
+    sift_up(table, used_count);
+    return token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -79,17 +166,17 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    size_t used_count = used_entries(table, table_count);
+    size_t index      = find_entry(table, used_count, token);
+    if (index == used_count) {
+        // Not found
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    table[index].trigger_time = timer_read32() + delay_ms;
+    reschedule_entry(table, used_count, index);
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -99,20 +186,25 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    size_t used_count = used_entries(table, table_count);
+    size_t index      = find_entry(table, used_count, token);
+    if (index == used_count) {
+        // Not found
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    remove_entry(table, used_count, index);
+    return true;
+}
+
+uint32_t deferred_exec_advanced_next_delay(deferred_executor_t *table, size_t table_count) {
+    if (!table || table_count == 0 || table[0].token == INVALID_DEFERRED_TOKEN) {
+        return DEFERRED_EXEC_IDLE;
+    }
+
+    int32_t remaining = (int32_t)TIMER_DIFF_32(table[0].trigger_time, timer_read32());
+    return remaining > 0 ? (uint32_t)remaining : 0;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
@@ -122,35 +214,45 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
+        // Nothing queued, or the earliest executor isn't due yet
+        if (table_count == 0 || table[0].token == INVALID_DEFERRED_TOKEN || ((int32_t)TIMER_DIFF_32(table[0].trigger_time, now)) > 0) {
+            return;
+        }
+
+        // Run the due executors in trigger order. An executor that falls behind can be requeued into the past, so
+        // bound the number of invocations to stop it from starving the main loop.
+        for (size_t runs = used_entries(table, table_count); runs > 0; --runs) {
+            deferred_executor_t *entry      = &table[0];
             deferred_token       curr_token = entry->token;
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
-
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
-
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
-                }
+            // Stop once the earliest remaining executor isn't due yet
+            if (curr_token == INVALID_DEFERRED_TOKEN || ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) > 0) {
+                break;
+            }
+
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+
+            // The callback may have queued, extended or cancelled executors, moving this one within the table
+            size_t used_count = used_entries(table, table_count);
+            size_t index      = table[0].token == curr_token ? 0 : find_entry(table, used_count, curr_token);
+
+            // If the token has gone, then the callback has canceled and re-queued. Skip further processing.
+            if (index == used_count) {
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                table[index].trigger_time += delay_ms;
+                reschedule_entry(table, used_count, index);
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                remove_entry(table, used_count, index);
             }
         }
     }
@@ -172,6 +274,9 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
 bool cancel_deferred_exec(deferred_token token) {
     return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
 }
+uint32_t deferred_exec_next_delay(void) {
+    return deferred_exec_advanced_next_delay(basic_executors, MAX_DEFERRED_EXECUTORS);
+}
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
@@ -21,6 +21,11 @@ typedef uint8_t deferred_token;
  */
 #define INVALID_DEFERRED_TOKEN 0
 
+/**
+ * @def The value returned by the next delay functions when nothing is queued.
+ */
+#define DEFERRED_EXEC_IDLE UINT32_MAX
+
 /**
  * @typedef Callback to execute.
  * @param trigger_time[in] the intended trigger time to execute the callback -- equivalent time-space as timer_read32()
@@ -60,6 +65,13 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms);
  */
 bool cancel_deferred_exec(deferred_token token);
 
+/**
+ * Gets the time until the next deferred execution is due, allowing the caller to sleep until then rather than polling.
+ *
+ * @return the number of milliseconds until the next deferred execution, 0 if one is already due, or DEFERRED_EXEC_IDLE if none are queued
+ */
+uint32_t deferred_exec_next_delay(void);
+
 /**
  * Forward declaration for the main loop in order to execute any deferred executors. Should not be invoked by keyboard/user code.
  */
@@ -72,7 +84,8 @@ void deferred_exec_task(void);
 /**
  * @struct Structure for containing self-hosted deferred executor tables.
  * @brief Core-side code can use this to create their own tables without impacting on the use of users' ability to add deferred execution.
- *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in an array.
+ *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in an array,
+ *        zero-initialised. The entries are kept in scheduling order, so they must only be modified through the API.
  */
 typedef struct deferred_executor_t {
     deferred_token         token;
@@ -110,6 +123,15 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  */
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token);
 
+/**
+ * Gets the time until the next deferred execution in a custom table is due.
+ *
+ * @param table[in] the custom table used for storage
+ * @param table_count[in] the number of available items in the table
+ * @return the number of milliseconds until the next deferred execution, 0 if one is already due, or DEFERRED_EXEC_IDLE if none are queued
+ */
+uint32_t deferred_exec_advanced_next_delay(deferred_executor_t *table, size_t table_count);
+
 /**
  * Forward declaration for the main loop in order to execute any custom table deferred executors. Should not be invoked by keyboard/user code.
  * Needed for any custom-allocated deferred execution tables. Any core tasks should add appropriate invocation to quantum/main.c.
@@ -14,13 +14,17 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
+
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "eeprom.h"
 #include "progmem.h"
 #include "send_string.h"
 #include "keycodes.h"
+#include "timer.h"
 
 #ifdef VIA_ENABLE
 #    include "via.h"
@@ -101,6 +105,49 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#define DYNAMIC_KEYMAP_EEPROM_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+// A copy of the keymap in EEPROM, in the same big-endian layout, so lookups don't have to go through the EEPROM driver
+static uint8_t  keymap_cache[DYNAMIC_KEYMAP_EEPROM_SIZE];
+static bool     keymap_cache_loaded = false;
+static uint16_t keymap_dirty_start  = DYNAMIC_KEYMAP_EEPROM_SIZE;
+static uint16_t keymap_dirty_end    = 0;
+static uint32_t keymap_dirty_time   = 0;
+
+static inline void keymap_cache_load(void) {
+    if (!keymap_cache_loaded) {
+        eeprom_read_block(keymap_cache, (void *)DYNAMIC_KEYMAP_EEPROM_ADDR, DYNAMIC_KEYMAP_EEPROM_SIZE);
+        keymap_cache_loaded = true;
+    }
+}
+
+// Records that [offset, offset + size) of the cache differs from EEPROM, to be written back once writes stop coming in
+static void keymap_cache_mark_dirty(uint16_t offset, uint16_t size) {
+    if (offset < keymap_dirty_start) {
+        keymap_dirty_start = offset;
+    }
+    if (offset + size > keymap_dirty_end) {
+        keymap_dirty_end = offset + size;
+    }
+    keymap_dirty_time = timer_read32();
+}
+
+void dynamic_keymap_flush(void) {
+    if (keymap_dirty_start < keymap_dirty_end) {
+        eeprom_update_block(&keymap_cache[keymap_dirty_start], (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + keymap_dirty_start), keymap_dirty_end - keymap_dirty_start);
+    }
+    keymap_dirty_start = DYNAMIC_KEYMAP_EEPROM_SIZE;
+    keymap_dirty_end   = 0;
+}
+
+void dynamic_keymap_task(void) {
+    if (keymap_dirty_start < keymap_dirty_end && timer_elapsed32(keymap_dirty_time) >= DYNAMIC_KEYMAP_WRITE_BACK_DELAY) {
+        dynamic_keymap_flush();
+    }
+}
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -112,19 +159,36 @@ void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t c
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    keymap_cache_load();
+    const uint8_t *cached = &keymap_cache[(layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2)];
+    return (cached[0] << 8) | cached[1];
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
     keycode |= eeprom_read_byte(address + 1);
     return keycode;
+#endif
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    keymap_cache_load();
+    uint16_t offset          = (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
+    keymap_cache[offset]     = (uint8_t)(keycode >> 8);
+    keymap_cache[offset + 1] = (uint8_t)(keycode & 0xFF);
+    keymap_cache_mark_dirty(offset, 2);
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#endif
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+    layer_lookup_cache_clear();
+#endif
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -165,14 +229,23 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    // Callers mark the EEPROM as valid straight after a reset, so it can't be left for later
+    dynamic_keymap_flush();
+#endif
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *target                     = data;
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    keymap_cache_load();
+    for (uint16_t i = 0; i < size; i++) {
+        data[i] = offset + i < DYNAMIC_KEYMAP_EEPROM_SIZE ? keymap_cache[offset + i] : 0x00;
+    }
+#else
+    void *   source = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    uint8_t *target = data;
     for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
+        if (offset + i < DYNAMIC_KEYMAP_EEPROM_SIZE) {
             *target = eeprom_read_byte(source);
         } else {
             *target = 0x00;
@@ -180,19 +253,33 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
         source++;
         target++;
     }
+#endif
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *source                     = data;
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (offset < DYNAMIC_KEYMAP_EEPROM_SIZE) {
+        if (size > DYNAMIC_KEYMAP_EEPROM_SIZE - offset) {
+            size = DYNAMIC_KEYMAP_EEPROM_SIZE - offset;
+        }
+        keymap_cache_load();
+        memcpy(&keymap_cache[offset], data, size);
+        keymap_cache_mark_dirty(offset, size);
+    }
+#else
+    void *   target = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    uint8_t *source = data;
     for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
+        if (offset + i < DYNAMIC_KEYMAP_EEPROM_SIZE) {
             eeprom_update_byte(target, *source);
         }
         source++;
         target++;
     }
+#endif
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+    layer_lookup_cache_clear();
+#endif
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -38,6 +38,17 @@ void dynamic_keymap_reset(void);
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+#    ifndef DYNAMIC_KEYMAP_WRITE_BACK_DELAY
+#        define DYNAMIC_KEYMAP_WRITE_BACK_DELAY 500
+#    endif
+
+// With the keymap cached in RAM, changes are written back to EEPROM in bulk once they stop
+// coming in for DYNAMIC_KEYMAP_WRITE_BACK_DELAY milliseconds, or straight away with dynamic_keymap_flush().
+void dynamic_keymap_flush(void);
+void dynamic_keymap_task(void);
+#endif
+
 // This overrides the one in quantum/keymap_common.c
 // uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
 
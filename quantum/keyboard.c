@@ -32,6 +32,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "task_profiler.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -104,6 +105,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_CACHE)
+#    include "dynamic_keymap.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
@@ -140,6 +144,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef OS_DETECTION_ENABLE
 #    include "os_detection.h"
 #endif
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC_ENABLE)
+#    include "send_string.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -520,6 +527,37 @@ static inline void generate_tick_event(void) {
     }
 }
 
+#ifndef MATRIX_EVENT_BATCH_SIZE
+#    define MATRIX_EVENT_BATCH_SIZE 8
+#endif
+
+#if (MATRIX_COLS <= 8)
+#    define matrix_row_ctz(bits) bitctz(bits)
+#elif (MATRIX_COLS <= 16)
+#    define matrix_row_ctz(bits) bitctz16(bits)
+#else
+#    define matrix_row_ctz(bits) bitctz32(bits)
+#endif
+
+typedef struct {
+    keypos_t key;
+    bool     pressed;
+} matrix_change_t;
+
+/**
+ * @brief Hands a batch of changed keys, in matrix order, to the action and
+ * switch event handlers.
+ */
+static void matrix_process_changes(const matrix_change_t changes[], uint8_t count, bool process_keypress) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (process_keypress) {
+            action_exec(MAKE_KEYEVENT(changes[i].key.row, changes[i].key.col, changes[i].pressed));
+        }
+
+        switch_events(changes[i].key.row, changes[i].key.col, changes[i].pressed);
+    }
+}
+
 /**
  * @brief This task scans the keyboards matrix and processes any key presses
  * that occur.
@@ -555,30 +593,34 @@ static bool matrix_task(void) {
 
     const bool process_keypress = should_process_keypress();
 
+    matrix_change_t changes[MATRIX_EVENT_BATCH_SIZE];
+    uint8_t         change_count = 0;
+
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
         const matrix_row_t current_row = matrix_get_row(row);
-        const matrix_row_t row_changes = current_row ^ matrix_previous[row];
+        matrix_row_t       row_changes = current_row ^ matrix_previous[row];
 
         if (!row_changes || has_ghost_in_row(row, current_row)) {
             continue;
         }
 
-        matrix_row_t col_mask = 1;
-        for (uint8_t col = 0; col < MATRIX_COLS; col++, col_mask <<= 1) {
-            if (row_changes & col_mask) {
-                const bool key_pressed = current_row & col_mask;
+        // Only visit the columns that actually changed, lowest column first
+        while (row_changes) {
+            const uint8_t col = matrix_row_ctz(row_changes);
+            row_changes &= row_changes - 1;
 
-                if (process_keypress) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
-                }
-
-                switch_events(row, col, key_pressed);
+            changes[change_count++] = (matrix_change_t){.key = MAKE_KEYPOS(row, col), .pressed = current_row & (MATRIX_ROW_SHIFTER << col)};
+            if (change_count == MATRIX_EVENT_BATCH_SIZE) {
+                matrix_process_changes(changes, change_count, process_keypress);
+                change_count = 0;
             }
         }
 
         matrix_previous[row] = current_row;
     }
 
+    matrix_process_changes(changes, change_count, process_keypress);
+
     return matrix_changed;
 }
 
@@ -613,73 +655,82 @@ void quantum_task(void) {
 #endif
 
 #if defined(AUDIO_ENABLE) && !defined(NO_MUSIC_MODE)
-    music_task();
+    TASK_PROFILE(TASK_PROFILER_MUSIC, music_task());
 #endif
 
 #ifdef KEY_OVERRIDE_ENABLE
-    key_override_task();
+    TASK_PROFILE(TASK_PROFILER_KEY_OVERRIDE, key_override_task());
 #endif
 
 #ifdef SEQUENCER_ENABLE
-    sequencer_task();
+    TASK_PROFILE(TASK_PROFILER_SEQUENCER, sequencer_task());
 #endif
 
 #ifdef TAP_DANCE_ENABLE
-    tap_dance_task();
+    TASK_PROFILE(TASK_PROFILER_TAP_DANCE, tap_dance_task());
 #endif
 
 #ifdef COMBO_ENABLE
-    combo_task();
+    TASK_PROFILE(TASK_PROFILER_COMBO, combo_task());
 #endif
 
 #ifdef LEADER_ENABLE
-    leader_task();
+    TASK_PROFILE(TASK_PROFILER_LEADER, leader_task());
 #endif
 
 #ifdef WPM_ENABLE
-    decay_wpm();
+    TASK_PROFILE(TASK_PROFILER_WPM, decay_wpm());
 #endif
 
 #ifdef DIP_SWITCH_ENABLE
-    dip_switch_task();
+    TASK_PROFILE(TASK_PROFILER_DIP_SWITCH, dip_switch_task());
 #endif
 
 #ifdef AUTO_SHIFT_ENABLE
-    autoshift_matrix_scan();
+    TASK_PROFILE(TASK_PROFILER_AUTO_SHIFT, autoshift_matrix_scan());
 #endif
 
 #ifdef CAPS_WORD_ENABLE
-    caps_word_task();
+    TASK_PROFILE(TASK_PROFILER_CAPS_WORD, caps_word_task());
 #endif
 
 #ifdef SECURE_ENABLE
     secure_task();
 #endif
+
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC_ENABLE)
+    send_string_async_task();
+#endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+
+#ifdef TASK_PROFILER_ENABLE
+    task_profiler_task();
+#endif
+
+    if (TASK_PROFILE_VALUE(TASK_PROFILER_MATRIX, matrix_task())) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    TASK_PROFILE(TASK_PROFILER_QUANTUM, quantum_task());
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
 #endif
 
 #if defined(RGBLIGHT_ENABLE)
-    rgblight_task();
+    TASK_PROFILE(TASK_PROFILER_RGBLIGHT, rgblight_task());
 #endif
 
 #ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
+    TASK_PROFILE(TASK_PROFILER_LED_MATRIX, led_matrix_task());
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    TASK_PROFILE(TASK_PROFILER_RGB_MATRIX, rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
@@ -689,21 +740,21 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ENCODER_ENABLE
-    if (encoder_task()) {
+    if (TASK_PROFILE_VALUE(TASK_PROFILER_ENCODER, encoder_task())) {
         last_encoder_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    if (TASK_PROFILE_VALUE(TASK_PROFILER_POINTING_DEVICE, pointing_device_task())) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef OLED_ENABLE
-    oled_task();
+    TASK_PROFILE(TASK_PROFILER_OLED, oled_task());
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
@@ -711,7 +762,7 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ST7565_ENABLE
-    st7565_task();
+    TASK_PROFILE(TASK_PROFILER_ST7565, st7565_task());
 #    if ST7565_TIMEOUT > 0
     // Wake up display if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) st7565_on();
@@ -720,7 +771,7 @@ void keyboard_task(void) {
 
 #ifdef MOUSEKEY_ENABLE
     // mousekey repeat & acceleration
-    mousekey_task();
+    TASK_PROFILE(TASK_PROFILER_MOUSEKEY, mousekey_task());
 #endif
 
 #ifdef PS2_MOUSE_ENABLE
@@ -740,12 +791,16 @@ void keyboard_task(void) {
 #endif
 
 #ifdef HAPTIC_ENABLE
-    haptic_task();
+    TASK_PROFILE(TASK_PROFILER_HAPTIC, haptic_task());
 #endif
 
-    led_task();
+    TASK_PROFILE(TASK_PROFILER_LED, led_task());
 
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_CACHE)
+    dynamic_keymap_task();
+#endif
 }
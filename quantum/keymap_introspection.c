@@ -41,6 +41,29 @@ __attribute__((weak)) uint16_t keycode_at_keymap_location(uint8_t layer_num, uin
     return keycode_at_keymap_location_raw(layer_num, row, column);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Source layers cache
+
+#if !defined(NO_ACTION_LAYER) && !defined(STRICT_LAYER_RELEASE) && defined(SOURCE_LAYERS_CACHE_COMPACT)
+
+#    ifndef SOURCE_LAYERS_CACHE_LAYERS
+#        ifdef DYNAMIC_KEYMAP_ENABLE
+#            define SOURCE_LAYERS_CACHE_LAYERS DYNAMIC_KEYMAP_LAYER_COUNT
+#        else
+#            define SOURCE_LAYERS_CACHE_LAYERS NUM_KEYMAP_LAYERS_RAW
+#        endif
+#    endif
+
+_Static_assert(SOURCE_LAYERS_CACHE_LAYERS <= MAX_LAYER, "SOURCE_LAYERS_CACHE_LAYERS exceeds the maximum number of layers");
+
+// Just enough bits per entry to hold the highest layer index
+#    define SOURCE_LAYERS_CACHE_BITS ((SOURCE_LAYERS_CACHE_LAYERS) > 16 ? 5 : (SOURCE_LAYERS_CACHE_LAYERS) > 8 ? 4 : (SOURCE_LAYERS_CACHE_LAYERS) > 4 ? 3 : (SOURCE_LAYERS_CACHE_LAYERS) > 2 ? 2 : 1)
+
+uint8_t       source_layers_cache[((SOURCE_LAYERS_CACHE_KEYS) * (SOURCE_LAYERS_CACHE_BITS) + 7) / 8] = {0};
+const uint8_t source_layers_cache_bits = SOURCE_LAYERS_CACHE_BITS;
+
+#endif // !defined(NO_ACTION_LAYER) && !defined(STRICT_LAYER_RELEASE) && defined(SOURCE_LAYERS_CACHE_COMPACT)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Encoder mapping
 
@@ -108,4 +131,66 @@ __attribute__((weak)) combo_t* combo_get(uint16_t combo_idx) {
     return combo_get_raw(combo_idx);
 }
 
+#    if defined(COMBO_INDEX_ENABLE)
+#        include "combo_index.h"
+#    endif
+
+#    if defined(COMBO_INDEX_ENABLE) && !defined(COMBO_INDEX_FALLBACK)
+_Static_assert(COMBO_INDEX_COMBO_COUNT == sizeof(key_combos) / sizeof(combo_t), "combo_index.h doesn't match key_combos, check that the combos aren't defined behind #if or by macros");
+
+static uint16_t combo_index_slot(uint16_t keycode) {
+#        ifdef COMBO_INDEX_SORTED
+    uint16_t low = 0, high = COMBO_INDEX_KEYCODE_COUNT;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (pgm_read_word(&combo_index_keycodes[mid]) < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low < COMBO_INDEX_KEYCODE_COUNT && pgm_read_word(&combo_index_keycodes[low]) == keycode) {
+        return low;
+    }
+#        else
+    for (uint16_t slot = 0; slot < COMBO_INDEX_KEYCODE_COUNT; ++slot) {
+        if (pgm_read_word(&combo_index_keycodes[slot]) == keycode) {
+            return slot;
+        }
+    }
+#        endif
+    return COMBO_INDEX_KEYCODE_COUNT;
+}
+
+bool combo_index_find_raw(uint16_t keycode, uint16_t* begin, uint16_t* end) {
+    uint16_t slot = combo_index_slot(keycode);
+    if (slot < COMBO_INDEX_KEYCODE_COUNT) {
+        *begin = pgm_read_word(&combo_index_offsets[slot]);
+        *end   = pgm_read_word(&combo_index_offsets[slot + 1]);
+    } else {
+        *begin = *end = 0;
+    }
+    return true;
+}
+
+uint16_t combo_index_get(uint16_t entry) {
+    return pgm_read_word(&combo_index_combos[entry]);
+}
+
+#    else
+
+bool combo_index_find_raw(uint16_t keycode, uint16_t* begin, uint16_t* end) {
+    return false;
+}
+
+uint16_t combo_index_get(uint16_t entry) {
+    return entry;
+}
+
+#    endif // defined(COMBO_INDEX_ENABLE) && !defined(COMBO_INDEX_FALLBACK)
+
+__attribute__((weak)) bool combo_index_find(uint16_t keycode, uint16_t* begin, uint16_t* end) {
+    return combo_index_find_raw(keycode, begin, end);
+}
+
 #endif // defined(COMBO_ENABLE)
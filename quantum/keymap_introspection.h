@@ -66,4 +66,13 @@ combo_t* combo_get_raw(uint16_t combo_idx);
 // Get the keycode for the encoder mapping location, potentially stored dynamically
 combo_t* combo_get(uint16_t combo_idx);
 
+// Find the combos containing the keycode in the index generated with COMBO_INDEX_ENABLE, as the range [begin, end) for combo_index_get().
+// Returns false if the keymap has no combo index, in which case every combo needs checking.
+bool combo_index_find_raw(uint16_t keycode, uint16_t* begin, uint16_t* end);
+// Find the combos containing the keycode, return false to have every combo checked (e.g. when combos are stored dynamically)
+bool combo_index_find(uint16_t keycode, uint16_t* begin, uint16_t* end);
+
+// Get the combo number stored at the combo index entry
+uint16_t combo_index_get(uint16_t entry);
+
 #endif // defined(COMBO_ENABLE)
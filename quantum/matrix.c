@@ -21,6 +21,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "matrix.h"
 #include "debounce.h"
 #include "atomic_util.h"
+#ifdef MATRIX_IDLE_WAKEUP
+#    include "timer.h"
+#endif
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -51,6 +54,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define MATRIX_INPUT_PRESSED_STATE 0
 #endif
 
+#ifdef MATRIX_IDLE_WAKEUP
+#    if defined(DIRECT_PINS) || !defined(MATRIX_ROW_PINS) || !defined(MATRIX_COL_PINS)
+#        error MATRIX_IDLE_WAKEUP requires a row/column matrix with both MATRIX_ROW_PINS and MATRIX_COL_PINS defined
+#    endif
+#    ifndef MATRIX_IDLE_WAKEUP_DELAY
+#        define MATRIX_IDLE_WAKEUP_DELAY 50
+#    endif
+#endif
+
 #ifdef DIRECT_PINS
 static SPLIT_MUTABLE pin_t direct_pins[ROWS_PER_HAND][MATRIX_COLS] = DIRECT_PINS;
 #elif (DIODE_DIRECTION == ROW2COL) || (DIODE_DIRECTION == COL2ROW)
@@ -270,6 +282,103 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #    error DIODE_DIRECTION is not defined!
 #endif
 
+#ifdef MATRIX_IDLE_WAKEUP
+/* Idle wakeup: once every key has been released for MATRIX_IDLE_WAKEUP_DELAY
+ * milliseconds, all select lines are driven at once, so reading a single line
+ * through the usual read function sees every key. The first key to go down
+ * restores the pins through matrix_init_pins() and a full scan runs within the
+ * same matrix_scan() call.
+ */
+#    if (DIODE_DIRECTION == COL2ROW)
+#        define IDLE_SELECT_COUNT ROWS_PER_HAND
+#        define idle_select(line) select_row(line)
+#    elif (DIODE_DIRECTION == ROW2COL)
+#        define IDLE_SELECT_COUNT MATRIX_COLS
+#        define idle_select(line) select_col(line)
+#    endif
+
+static bool     matrix_parked     = false;
+static uint8_t  matrix_idle_line  = 0;
+static uint16_t matrix_idle_timer = 0;
+
+/** \brief matrix_wait_for_edge
+ *
+ * Called on every scan while the matrix is parked. Override to sleep the MCU
+ * until a pin-change interrupt on the input lines or the next timer tick.
+ */
+__attribute__((weak)) void matrix_wait_for_edge(void) {}
+
+static void matrix_park(void) {
+    bool selected = false;
+    for (uint8_t x = IDLE_SELECT_COUNT; x-- > 0;) {
+        if (idle_select(x)) {
+            // The lowest line with a pin is the one read while parked
+            matrix_idle_line = x;
+            selected         = true;
+        }
+    }
+    if (!selected) {
+        return;
+    }
+    matrix_output_select_delay();
+    matrix_parked = true;
+}
+
+static void matrix_unpark(void) {
+    matrix_init_pins();
+    matrix_output_unselect_delay(matrix_idle_line, true);
+    matrix_parked = false;
+}
+
+static bool matrix_edge_detected(void) {
+    matrix_row_t parked_matrix[MATRIX_ROWS] = {0};
+
+#    if (DIODE_DIRECTION == COL2ROW)
+    matrix_read_cols_on_row(parked_matrix, matrix_idle_line);
+#    elif (DIODE_DIRECTION == ROW2COL)
+    matrix_read_rows_on_col(parked_matrix, matrix_idle_line, MATRIX_ROW_SHIFTER << matrix_idle_line);
+#    endif
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        if (parked_matrix[row]) {
+            return true;
+        }
+    }
+
+    // Reading unselected the line, drive it again with the others
+    idle_select(matrix_idle_line);
+    matrix_output_select_delay();
+    return false;
+}
+
+/* Returns true when a full scan is required. */
+static bool matrix_idle_check(void) {
+    if (!matrix_parked) {
+        return true;
+    }
+    matrix_wait_for_edge();
+    if (!matrix_edge_detected()) {
+        return false;
+    }
+    matrix_unpark();
+    return true;
+}
+
+static void matrix_idle_update(const matrix_row_t local_matrix[]) {
+    if (matrix_parked) {
+        return;
+    }
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        if (raw_matrix[row] || local_matrix[row]) {
+            matrix_idle_timer = timer_read();
+            return;
+        }
+    }
+    if (timer_elapsed(matrix_idle_timer) >= MATRIX_IDLE_WAKEUP_DELAY) {
+        matrix_park();
+    }
+}
+#endif
+
 void matrix_init(void) {
 #ifdef SPLIT_KEYBOARD
     // Set pinout for right half if pinout for that half is defined
@@ -323,26 +432,38 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 uint8_t matrix_scan(void) {
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
+#ifdef MATRIX_IDLE_WAKEUP
+    // Parked with nothing pressed: the all-zero curr_matrix is already accurate
+    if (matrix_idle_check())
+#endif
+    {
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
-    // Set row, read cols
-    for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
-        matrix_read_cols_on_row(curr_matrix, current_row);
-    }
+        // Set row, read cols
+        for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
+            matrix_read_cols_on_row(curr_matrix, current_row);
+        }
 #elif (DIODE_DIRECTION == ROW2COL)
-    // Set col, read rows
-    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
-    for (uint8_t current_col = 0; current_col < MATRIX_COLS; current_col++, row_shifter <<= 1) {
-        matrix_read_rows_on_col(curr_matrix, current_col, row_shifter);
-    }
+        // Set col, read rows
+        matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+        for (uint8_t current_col = 0; current_col < MATRIX_COLS; current_col++, row_shifter <<= 1) {
+            matrix_read_rows_on_col(curr_matrix, current_col, row_shifter);
+        }
 #endif
+    }
 
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
 
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
+#    ifdef MATRIX_IDLE_WAKEUP
+    matrix_idle_update(matrix + thisHand);
+#    endif
 #else
     changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+#    ifdef MATRIX_IDLE_WAKEUP
+    matrix_idle_update(matrix);
+#    endif
     matrix_scan_kb();
 #endif
     return (uint8_t)changed;
@@ -69,6 +69,9 @@ void matrix_io_delay(void);
 void matrix_power_up(void);
 void matrix_power_down(void);
 
+/* called while idle wakeup has parked the matrix, waiting for a key to go down */
+void matrix_wait_for_edge(void);
+
 void matrix_init_kb(void);
 void matrix_scan_kb(void);
 
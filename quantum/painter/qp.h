@@ -72,6 +72,24 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_DRAW_CACHE_SIZE
+/**
+ * @def This controls the amount of RAM (in bytes) set aside for caching glyphs and image frames once they have been
+ *      decoded into the panel's native pixel format. Drawing the same glyph or frame again, with the same colors,
+ *      then skips decoding and palette conversion and sends the cached pixels straight to the display. Defaults to 0,
+ *      which disables the cache.
+ */
+#    define QUANTUM_PAINTER_DRAW_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_DRAW_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_DRAW_CACHE_ENTRIES
+/**
+ * @def This controls the maximum number of glyphs and image frames held in the draw cache at any one time. When either
+ *      this or \ref QUANTUM_PAINTER_DRAW_CACHE_SIZE runs out, the least recently drawn entries are dropped.
+ */
+#    define QUANTUM_PAINTER_DRAW_CACHE_ENTRIES 32
+#endif // QUANTUM_PAINTER_DRAW_CACHE_ENTRIES
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -129,6 +147,16 @@ typedef struct painter_font_desc_t {
  */
 typedef const painter_font_desc_t *painter_font_handle_t;
 
+/**
+ * @typedef Statistics of the draw cache, as retrieved by \ref qp_get_cache_stats.
+ */
+typedef struct painter_cache_stats_t {
+    uint32_t hits;       ///< Number of glyphs and frames drawn from the cache
+    uint32_t misses;     ///< Number of glyphs and frames that had to be decoded
+    uint32_t evictions;  ///< Number of entries dropped to make room for others
+    uint32_t bytes_used; ///< Amount of RAM (in bytes) currently holding cached pixels
+} painter_cache_stats_t;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API
 
@@ -488,6 +516,20 @@ int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_fon
  */
 int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
 
+/**
+ * Retrieves the statistics of the draw cache.
+ *
+ * @note All counters are zero if the cache is disabled, see \ref QUANTUM_PAINTER_DRAW_CACHE_SIZE.
+ *
+ * @param stats[out] the statistics of the draw cache
+ */
+void qp_get_cache_stats(painter_cache_stats_t *stats);
+
+/**
+ * Drops every glyph and image frame held in the draw cache, and resets its statistics.
+ */
+void qp_clear_cache(void);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Drivers
 
@@ -97,4 +97,69 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg);
 //     - qp_internal_send_bytes                                  (bpp > 8)
 bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state);
 
+// Helper shared between image and font rendering, decodes pixels into the supplied buffer in the display's native format instead of sending them
+bool qp_internal_decode_to_buffer(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state, uint8_t* buffer);
+
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter draw cache
+
+typedef struct qp_internal_cache_entry_t {
+    // What was drawn, and how
+    painter_device_t device;
+    const void*      asset;
+    uint32_t         id; // code point for glyphs, frame number for images
+    qp_pixel_t       fg_hsv888;
+    qp_pixel_t       bg_hsv888;
+
+    // Where the pixels go, relative to the position the asset is drawn at
+    uint16_t left;
+    uint16_t top;
+    uint16_t width;
+    uint16_t height;
+
+    // Frame delay, for animations
+    uint16_t delay;
+
+    // Location of the pixels in the cache, and when they were last drawn
+    uint32_t offset;
+    uint32_t size;
+    uint32_t last_used;
+    bool     in_use;
+} qp_internal_cache_entry_t;
+
+#if (QUANTUM_PAINTER_DRAW_CACHE_SIZE) > 0
+
+// Finds the entry for the asset, updating the hit/miss counters. Returns NULL on a miss.
+qp_internal_cache_entry_t* qp_internal_cache_lookup(painter_device_t device, const void* asset, uint32_t id, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888);
+
+// Makes room for the pixels of a width x height block, dropping the least recently drawn entries if needed. Returns NULL if it can't be cached.
+qp_internal_cache_entry_t* qp_internal_cache_insert(painter_device_t device, const void* asset, uint32_t id, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint16_t width, uint16_t height);
+
+// Decodes the pixels into an entry returned by qp_internal_cache_insert. The entry is dropped on failure.
+bool qp_internal_cache_fill(qp_internal_cache_entry_t* entry, uint8_t bpp, qp_internal_byte_input_callback input_callback, void* input_state);
+
+// Sends the entry's pixels to the current viewport of its device
+bool qp_internal_cache_send(qp_internal_cache_entry_t* entry);
+
+// Drops every entry for the asset, as its handle is about to be reused
+void qp_internal_cache_invalidate(const void* asset);
+
+#else // (QUANTUM_PAINTER_DRAW_CACHE_SIZE) > 0
+
+static inline qp_internal_cache_entry_t* qp_internal_cache_lookup(painter_device_t device, const void* asset, uint32_t id, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    return NULL;
+}
+static inline qp_internal_cache_entry_t* qp_internal_cache_insert(painter_device_t device, const void* asset, uint32_t id, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint16_t width, uint16_t height) {
+    return NULL;
+}
+static inline bool qp_internal_cache_fill(qp_internal_cache_entry_t* entry, uint8_t bpp, qp_internal_byte_input_callback input_callback, void* input_state) {
+    return false;
+}
+static inline bool qp_internal_cache_send(qp_internal_cache_entry_t* entry) {
+    return false;
+}
+static inline void qp_internal_cache_invalidate(const void* asset) {}
+
+#endif // (QUANTUM_PAINTER_DRAW_CACHE_SIZE) > 0
@@ -0,0 +1,170 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "qp_internal.h"
+#include "qp_draw.h"
+
+#if (QUANTUM_PAINTER_DRAW_CACHE_SIZE) > 0
+
+// Blocks start on a 4-byte boundary, so that drivers can write native pixels wider than a byte
+#    define QP_CACHE_ALIGN(n) (((n) + 3) & ~(uint32_t)3)
+
+static uint8_t                   qp_cache_pool[QP_CACHE_ALIGN(QUANTUM_PAINTER_DRAW_CACHE_SIZE)] __attribute__((aligned(4)));
+static qp_internal_cache_entry_t qp_cache_entries[QUANTUM_PAINTER_DRAW_CACHE_ENTRIES];
+static painter_cache_stats_t     qp_cache_stats;
+
+// Incremented on every hit or insertion, entries with the lowest value were drawn least recently
+static uint32_t qp_cache_clock;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+
+static inline bool qp_cache_same_color(qp_pixel_t a, qp_pixel_t b) {
+    return a.hsv888.h == b.hsv888.h && a.hsv888.s == b.hsv888.s && a.hsv888.v == b.hsv888.v;
+}
+
+static void qp_cache_drop(qp_internal_cache_entry_t *entry) {
+    entry->in_use = false;
+    qp_cache_stats.bytes_used -= entry->size;
+}
+
+static bool qp_cache_overlaps_block_in_use(uint32_t start, uint32_t size) {
+    for (uint16_t i = 0; i < QUANTUM_PAINTER_DRAW_CACHE_ENTRIES; ++i) {
+        qp_internal_cache_entry_t *entry = &qp_cache_entries[i];
+        if (entry->in_use && entry->offset < start + size && start < entry->offset + entry->size) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Finds a gap of `size` bytes in the pool. Gaps can only start at the beginning of the pool, or right after a block.
+static bool qp_cache_find_space(uint32_t size, uint32_t *offset) {
+    for (int16_t i = -1; i < QUANTUM_PAINTER_DRAW_CACHE_ENTRIES; ++i) {
+        uint32_t start = 0;
+        if (i >= 0) {
+            if (!qp_cache_entries[i].in_use) {
+                continue;
+            }
+            start = qp_cache_entries[i].offset + qp_cache_entries[i].size;
+        }
+
+        if (start + size <= sizeof(qp_cache_pool) && !qp_cache_overlaps_block_in_use(start, size)) {
+            *offset = start;
+            return true;
+        }
+    }
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter Core API: draw cache
+
+qp_internal_cache_entry_t *qp_internal_cache_lookup(painter_device_t device, const void *asset, uint32_t id, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (uint16_t i = 0; i < QUANTUM_PAINTER_DRAW_CACHE_ENTRIES; ++i) {
+        qp_internal_cache_entry_t *entry = &qp_cache_entries[i];
+        if (entry->in_use && entry->device == device && entry->asset == asset && entry->id == id && qp_cache_same_color(entry->fg_hsv888, fg_hsv888) && qp_cache_same_color(entry->bg_hsv888, bg_hsv888)) {
+            entry->last_used = ++qp_cache_clock;
+            ++qp_cache_stats.hits;
+            return entry;
+        }
+    }
+
+    ++qp_cache_stats.misses;
+    return NULL;
+}
+
+qp_internal_cache_entry_t *qp_internal_cache_insert(painter_device_t device, const void *asset, uint32_t id, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint16_t width, uint16_t height) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    uint32_t          size   = QP_CACHE_ALIGN((((uint32_t)width) * height * driver->native_bits_per_pixel + 7) / 8);
+    if (size == 0 || size > sizeof(qp_cache_pool)) {
+        qp_dprintf("qp_internal_cache_insert: block of %d bytes does not fit in the cache\n", (int)size);
+        return NULL;
+    }
+
+    while (true) {
+        qp_internal_cache_entry_t *free_entry = NULL;
+        qp_internal_cache_entry_t *oldest     = NULL;
+        for (uint16_t i = 0; i < QUANTUM_PAINTER_DRAW_CACHE_ENTRIES; ++i) {
+            qp_internal_cache_entry_t *entry = &qp_cache_entries[i];
+            if (!entry->in_use) {
+                free_entry = free_entry ? free_entry : entry;
+            } else if (!oldest || entry->last_used < oldest->last_used) {
+                oldest = entry;
+            }
+        }
+
+        uint32_t offset;
+        if (free_entry && qp_cache_find_space(size, &offset)) {
+            *free_entry = (qp_internal_cache_entry_t){
+                .device    = device,
+                .asset     = asset,
+                .id        = id,
+                .fg_hsv888 = fg_hsv888,
+                .bg_hsv888 = bg_hsv888,
+                .width     = width,
+                .height    = height,
+                .offset    = offset,
+                .size      = size,
+                .last_used = ++qp_cache_clock,
+                .in_use    = true,
+            };
+            qp_cache_stats.bytes_used += size;
+            return free_entry;
+        }
+
+        // Out of entries or space, make room by dropping the least recently drawn block
+        if (!oldest) {
+            return NULL;
+        }
+        qp_cache_drop(oldest);
+        ++qp_cache_stats.evictions;
+    }
+}
+
+bool qp_internal_cache_fill(qp_internal_cache_entry_t *entry, uint8_t bpp, qp_internal_byte_input_callback input_callback, void *input_state) {
+    if (!qp_internal_decode_to_buffer(entry->device, bpp, ((uint32_t)entry->width) * entry->height, input_callback, input_state, &qp_cache_pool[entry->offset])) {
+        qp_dprintf("qp_internal_cache_fill: fail (could not decode pixels)\n");
+        qp_cache_drop(entry);
+        return false;
+    }
+    return true;
+}
+
+bool qp_internal_cache_send(qp_internal_cache_entry_t *entry) {
+    painter_driver_t *driver = (painter_driver_t *)entry->device;
+    return driver->driver_vtable->pixdata(entry->device, &qp_cache_pool[entry->offset], ((uint32_t)entry->width) * entry->height);
+}
+
+void qp_internal_cache_invalidate(const void *asset) {
+    for (uint16_t i = 0; i < QUANTUM_PAINTER_DRAW_CACHE_ENTRIES; ++i) {
+        if (qp_cache_entries[i].in_use && qp_cache_entries[i].asset == asset) {
+            qp_cache_drop(&qp_cache_entries[i]);
+        }
+    }
+}
+
+#endif // (QUANTUM_PAINTER_DRAW_CACHE_SIZE) > 0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_get_cache_stats
+
+void qp_get_cache_stats(painter_cache_stats_t *stats) {
+#if (QUANTUM_PAINTER_DRAW_CACHE_SIZE) > 0
+    *stats = qp_cache_stats;
+#else
+    memset(stats, 0, sizeof(painter_cache_stats_t));
+#endif // (QUANTUM_PAINTER_DRAW_CACHE_SIZE) > 0
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_clear_cache
+
+void qp_clear_cache(void) {
+#if (QUANTUM_PAINTER_DRAW_CACHE_SIZE) > 0
+    memset(qp_cache_entries, 0, sizeof(qp_cache_entries));
+    memset(&qp_cache_stats, 0, sizeof(qp_cache_stats));
+#endif // (QUANTUM_PAINTER_DRAW_CACHE_SIZE) > 0
+}
@@ -204,6 +204,43 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
     return ret;
 }
 
+// Output state for decoding into a caller-supplied buffer, rather than the global pixdata buffer
+typedef struct qp_internal_buffer_output_state_t {
+    painter_device_t device;
+    uint8_t*         buffer;
+    uint32_t         write_pos;
+} qp_internal_buffer_output_state_t;
+
+static bool qp_internal_buffer_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
+    qp_internal_buffer_output_state_t* state  = (qp_internal_buffer_output_state_t*)cb_arg;
+    painter_driver_t*                  driver = (painter_driver_t*)state->device;
+    return driver->driver_vtable->append_pixels(state->device, state->buffer, palette, state->write_pos++, 1, &index);
+}
+
+static bool qp_internal_buffer_byte_appender(uint8_t byteval, void* cb_arg) {
+    qp_internal_buffer_output_state_t* state  = (qp_internal_buffer_output_state_t*)cb_arg;
+    painter_driver_t*                  driver = (painter_driver_t*)state->device;
+    return driver->driver_vtable->append_pixdata(state->device, state->buffer, state->write_pos++, byteval);
+}
+
+// Helper shared between image and font rendering -- same as qp_internal_appender, but the native pixels are left in the supplied buffer instead of being sent to the display
+bool qp_internal_decode_to_buffer(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state, uint8_t* buffer) {
+    painter_driver_t*                 driver       = (painter_driver_t*)device;
+    qp_internal_buffer_output_state_t output_state = {.device = device, .buffer = buffer, .write_pos = 0};
+
+    // Non-native pixel format
+    if (bpp <= 8) {
+        return qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_buffer_pixel_appender, &output_state);
+    }
+
+    // Native pixel format
+    if (bpp != driver->native_bits_per_pixel) {
+        qp_dprintf("Asset's bpp (%d) doesn't match the target display's native_bits_per_pixel (%d)\n", bpp, driver->native_bits_per_pixel);
+        return false;
+    }
+    return qp_internal_send_bytes(device, pixel_count * bpp / 8, input_callback, input_state, qp_internal_buffer_byte_appender, &output_state);
+}
+
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression) {
     switch (compression) {
         case IMAGE_UNCOMPRESSED:
@@ -95,6 +95,9 @@ bool qp_close_image(painter_image_handle_t image) {
         return false;
     }
 
+    // Drop any frames of this image from the draw cache, as the handle will be reused
+    qp_internal_cache_invalidate(qgf_image);
+
     // Free up this image for use elsewhere.
     qgf_image->validate_ok = false;
     qp_stream_close(&qgf_image->stream);
@@ -222,6 +225,24 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
+    // If this frame was decoded before with the same colors, send the cached pixels instead
+    qp_internal_cache_entry_t *cached = qp_internal_cache_lookup(device, qgf_image, frame_number, fg_hsv888, bg_hsv888);
+    if (cached) {
+        if (!qp_comms_start(device)) {
+            qp_dprintf("qp_drawimage_recolor: fail (could not start comms)\n");
+            return false;
+        }
+
+        uint16_t l   = x + cached->left;
+        uint16_t t   = y + cached->top;
+        bool     ret = driver->driver_vtable->viewport(device, l, t, l + cached->width - 1, t + cached->height - 1) && qp_internal_cache_send(cached);
+
+        frame_info->delay = cached->delay;
+        qp_dprintf("qp_drawimage_recolor: %s (cached)\n", ret ? "ok" : "fail");
+        qp_comms_stop(device);
+        return ret;
+    }
+
     // Read the frame info
     if (!qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, frame_info)) {
         qp_dprintf("qp_drawimage_recolor: fail (could not read frame %d)\n", frame_number);
@@ -263,8 +284,17 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
-    // Decode and stream pixels
-    bool ret = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
+    // Decode into the draw cache if there is room for the frame, otherwise stream the pixels as they are decoded
+    bool                       ret;
+    qp_internal_cache_entry_t *entry = qp_internal_cache_insert(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, r - l + 1, b - t + 1);
+    if (entry) {
+        entry->left  = l - x;
+        entry->top   = t - y;
+        entry->delay = frame_info->delay;
+        ret          = qp_internal_cache_fill(entry, frame_info->bpp, input_callback, &input_state) && qp_internal_cache_send(entry);
+    } else {
+        ret = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
+    }
 
     qp_dprintf("qp_drawimage_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
@@ -151,6 +151,9 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+    // Drop any glyphs of this font from the draw cache, as the handle will be reused
+    qp_internal_cache_invalidate(qff_font);
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -163,6 +166,9 @@ bool qp_close_font(painter_font_handle_t font) {
 // Callback to be invoked for each codepoint detected in the UTF8 input string
 typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg);
 
+// Optional callback to be invoked for each codepoint before the glyph is looked up in the font, sets handled if the glyph needs no further work
+typedef bool (*code_point_prehandler)(qff_font_handle_t *qff_font, uint32_t code_point, bool *handled, void *cb_arg);
+
 // Helper that sets up the palette (if required) and returns the offset in the stream that the data starts
 static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device, qff_font_handle_t *qff_font, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint32_t *data_offset) {
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -293,7 +299,7 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
 }
 
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
-static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const char *str, code_point_handler handler, void *cb_arg) {
+static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const char *str, code_point_prehandler prehandler, code_point_handler handler, void *cb_arg) {
     while (*str) {
         int32_t code_point = 0;
         str                = decode_utf8(str, &code_point);
@@ -302,6 +308,17 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
             return false;
         }
 
+        if (prehandler) {
+            bool handled = false;
+            if (!prehandler(qff_font, code_point, &handled, cb_arg)) {
+                qp_dprintf("Failed to execute glyph prehandler.\n");
+                return false;
+            }
+            if (handled) {
+                continue;
+            }
+        }
+
         uint8_t width;
         if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
             qp_dprintf("Failed to prepare glyph for rendering.\n");
@@ -342,11 +359,39 @@ typedef struct code_point_iter_drawglyph_state_t {
     painter_device_t                  device;
     int16_t                           xpos;
     int16_t                           ypos;
+    qp_pixel_t                        fg_hsv888;
+    qp_pixel_t                        bg_hsv888;
+    bool                              font_prepared;
     qp_internal_byte_input_callback   input_callback;
     qp_internal_byte_input_state_t *  input_state;
     qp_internal_pixel_output_state_t *output_state;
 } code_point_iter_drawglyph_state_t;
 
+// Codepoint prehandler callback: drawing from the draw cache
+static inline bool qp_font_code_point_prehandler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, bool *handled, void *cb_arg) {
+    code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
+    painter_driver_t *                 driver = (painter_driver_t *)state->device;
+
+    // If this glyph was decoded before with the same colors, send the cached pixels instead
+    qp_internal_cache_entry_t *cached = qp_internal_cache_lookup(state->device, qff_font, code_point, state->fg_hsv888, state->bg_hsv888);
+    if (cached) {
+        *handled = driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + cached->width - 1, state->ypos + cached->height - 1) && qp_internal_cache_send(cached);
+        state->xpos += cached->width;
+        return *handled;
+    }
+
+    // The palette is only needed once a glyph has to be decoded
+    if (!state->font_prepared) {
+        uint32_t data_offset;
+        if (!qp_drawtext_prepare_font_for_render(state->device, qff_font, state->fg_hsv888, state->bg_hsv888, &data_offset)) {
+            qp_dprintf("Failed to prepare font for rendering.\n");
+            return false;
+        }
+        state->font_prepared = true;
+    }
+    return true;
+}
+
 // Codepoint handler callback: drawing
 static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
     code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
@@ -364,7 +409,13 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     // Move the x-position for the next glyph
     state->xpos += width;
 
-    // Decode the pixel data for the glyph, and stream it
+    // Decode the pixel data for the glyph into the draw cache if there is room for it
+    qp_internal_cache_entry_t *entry = qp_internal_cache_insert(state->device, qff_font, code_point, state->fg_hsv888, state->bg_hsv888, width, height);
+    if (entry) {
+        return qp_internal_cache_fill(entry, qff_font->bpp, state->input_callback, state->input_state) && qp_internal_cache_send(entry);
+    }
+
+    // Otherwise decode the pixel data for the glyph, and stream it
     uint32_t pixel_count = ((uint32_t)width) * height;
     return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
 }
@@ -382,7 +433,7 @@ int16_t qp_textwidth(painter_font_handle_t font, const char *str) {
     // Create the codepoint iterator state
     code_point_iter_calcwidth_state_t state = {.width = 0};
     // Iterate each codepoint, return the calculated width if successful.
-    return qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_calcwidth, &state) ? state.width : 0;
+    return qp_iterate_code_points(qff_font, str, NULL, qp_font_code_point_handler_calcwidth, &state) ? state.width : 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -428,28 +479,23 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
     // Set up the pixel output state
     qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
 
-    // Set up the codepoint iteration state
+    // Set up the codepoint iteration state -- the font is prepared for rendering on the first glyph that isn't cached
     code_point_iter_drawglyph_state_t state = {// Common
                                                .device = device,
                                                .xpos   = x,
                                                .ypos   = y,
+                                               // Colors
+                                               .fg_hsv888     = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}},
+                                               .bg_hsv888     = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}},
+                                               .font_prepared = false,
                                                // Input
                                                .input_callback = input_callback,
                                                .input_state    = &input_state,
                                                // Output
                                                .output_state = &output_state};
 
-    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
-    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
-    if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
-        qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
-        qp_comms_stop(device);
-        return false;
-    }
-
-    // Iterate the codepoints with the drawglyph callback
-    bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
+    // Iterate the codepoints with the drawglyph callbacks
+    bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_prehandler_drawglyph, qp_font_code_point_handler_drawglyph, &state);
 
     qp_dprintf("qp_drawtext_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
@@ -3,6 +3,10 @@
 
 #include "qp_internal.h"
 
+#ifdef QUANTUM_PAINTER_SURFACE_ENABLE
+#    include "qp_surface_internal.h"
+#endif // QUANTUM_PAINTER_SURFACE_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Core API: device registration
 
@@ -20,7 +24,7 @@ enum {
                      + (SH1106_NUM_DEVICES)  // SH1106
 };
 
-static painter_device_t qp_devices[QP_NUM_DEVICES] = {NULL};
+static painter_device_t qp_devices[QP_NUM_DEVICES];
 
 bool qp_internal_register_device(painter_device_t driver) {
     for (uint8_t i = 0; i < QP_NUM_DEVICES; i++) {
@@ -67,6 +71,11 @@ static void qp_internal_display_timeout_task(void) {
 _Static_assert((QUANTUM_PAINTER_TASK_THROTTLE) > 0 && (QUANTUM_PAINTER_TASK_THROTTLE) < 1000, "QUANTUM_PAINTER_TASK_THROTTLE must be between 1 and 999");
 
 void qp_internal_task(void) {
+#ifdef QUANTUM_PAINTER_SURFACE_ENABLE
+    // Keep asynchronous surface draws moving on every pass, chunks complete faster than the throttle
+    qp_surface_async_task();
+#endif // QUANTUM_PAINTER_SURFACE_ENABLE
+
     // Perform throttling of the internal processing of Quantum Painter
     static uint32_t last_tick = 0;
     uint32_t        now       = timer_read32();
@@ -26,6 +26,7 @@ typedef struct painter_driver_vtable_t {
     painter_driver_flush_func           flush;
     painter_driver_viewport_func        viewport;
     painter_driver_pixdata_func         pixdata;
+    painter_driver_pixdata_func         pixdata_async; // optional, returns before the pixel data has been sent
     painter_driver_convert_palette_func palette_convert;
     painter_driver_append_pixels        append_pixels;
     painter_driver_append_pixdata       append_pixdata;
@@ -38,12 +39,16 @@ typedef bool (*painter_driver_comms_init_func)(painter_device_t device);
 typedef bool (*painter_driver_comms_start_func)(painter_device_t device);
 typedef void (*painter_driver_comms_stop_func)(painter_device_t device);
 typedef uint32_t (*painter_driver_comms_send_func)(painter_device_t device, const void *data, uint32_t byte_count);
+typedef bool (*painter_driver_comms_send_async_func)(painter_device_t device, const void *data, uint32_t byte_count);
+typedef bool (*painter_driver_comms_busy_func)(painter_device_t device);
 
 typedef struct painter_comms_vtable_t {
-    painter_driver_comms_init_func  comms_init;
-    painter_driver_comms_start_func comms_start;
-    painter_driver_comms_stop_func  comms_stop;
-    painter_driver_comms_send_func  comms_send;
+    painter_driver_comms_init_func       comms_init;
+    painter_driver_comms_start_func      comms_start;
+    painter_driver_comms_stop_func       comms_stop;
+    painter_driver_comms_send_func       comms_send;
+    painter_driver_comms_send_async_func comms_send_async; // optional, the data must be left untouched until comms_busy returns false
+    painter_driver_comms_busy_func       comms_busy;       // optional, required if comms_send_async is provided
 } painter_comms_vtable_t;
 
 typedef void (*painter_driver_comms_send_command_func)(painter_device_t device, uint8_t cmd);
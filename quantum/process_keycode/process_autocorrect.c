@@ -22,6 +22,27 @@
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
+#if defined(AUTOCORRECT_DATA_VERSION) && AUTOCORRECT_DATA_VERSION >= 2
+// Trie nodes, told apart by the two high bits of their first byte. See the generator for the layout.
+#    define AUTOCORRECT_NODE_MASK 0xC0
+#    define AUTOCORRECT_NODE_CHAIN 0x00
+#    define AUTOCORRECT_NODE_LIST 0x40
+#    define AUTOCORRECT_NODE_LEAF 0x80
+#    define AUTOCORRECT_NODE_TABLE 0xC0
+#    define AUTOCORRECT_CHAIN_LINK 0x20
+#    define AUTOCORRECT_CHAIN_LENGTH_MASK 0x1F
+#    define AUTOCORRECT_LIST_LENGTH_MASK 0x3F
+#    define AUTOCORRECT_TABLE_BITMAP_SIZE 4
+
+#    if AUTOCORRECT_LINK_SIZE > 2
+typedef uint32_t autocorrect_offset_t;
+#    else
+typedef uint16_t autocorrect_offset_t;
+#    endif
+#else
+typedef uint16_t autocorrect_offset_t;
+#endif
+
 /**
  * @brief function for querying the enabled state of autocorrect
  *
@@ -188,6 +209,151 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+#if defined(AUTOCORRECT_DATA_VERSION) && AUTOCORRECT_DATA_VERSION >= 2
+/**
+ * @brief Reads a little-endian link to another node of the trie
+ *
+ * @param offset where the link is stored
+ * @return autocorrect_offset_t offset of the linked node
+ */
+static autocorrect_offset_t autocorrect_read_link(autocorrect_offset_t offset) {
+    autocorrect_offset_t link = 0;
+    for (uint8_t i = 0; i < AUTOCORRECT_LINK_SIZE; ++i) {
+        link |= (autocorrect_offset_t)pgm_read_byte(autocorrect_data + offset + i) << (8 * i);
+    }
+    return link;
+}
+
+/**
+ * @brief Maps a keycode in the typo buffer to the char it is stored as in the trie
+ *
+ * @param keycode KC_A to KC_Z, KC_QUOTE or KC_SPC
+ * @return uint8_t 0 to 25 for a to z, 26 for ' and 27 for a word break
+ */
+static uint8_t autocorrect_char_index(uint8_t keycode) {
+    switch (keycode) {
+        case KC_QUOTE:
+            return 26;
+        case KC_SPC:
+            return 27;
+        default:
+            return keycode - KC_A;
+    }
+}
+
+/**
+ * @brief Walks the trie back from the last key in the typo buffer
+ *
+ * Chains of single children are compared a char at a time, and nodes with
+ * many children are looked up in their bitmap, so each key typed costs the
+ * same whatever the size of the dictionary.
+ *
+ * @return autocorrect_offset_t offset of the leaf for the typo that was found, or 0 if there is none
+ */
+static autocorrect_offset_t autocorrect_find_typo(void) {
+    autocorrect_offset_t state = 0;
+    for (int8_t i = typo_buffer_size - 1; i >= 0;) {
+        uint8_t const code = pgm_read_byte(autocorrect_data + state);
+
+        switch (code & AUTOCORRECT_NODE_MASK) {
+            case AUTOCORRECT_NODE_CHAIN: {
+                uint8_t const length = code & AUTOCORRECT_CHAIN_LENGTH_MASK;
+                for (uint8_t j = 1; j <= length; ++j, --i) {
+                    if (i < 0 || pgm_read_byte(autocorrect_data + state + j) != autocorrect_char_index(typo_buffer[i])) {
+                        return 0;
+                    }
+                }
+                // The child follows the chain, unless it is shared and linked to.
+                state += 1 + length;
+                if (code & AUTOCORRECT_CHAIN_LINK) {
+                    state = autocorrect_read_link(state);
+                }
+                break;
+            }
+            case AUTOCORRECT_NODE_LIST: {
+                uint8_t const count = code & AUTOCORRECT_LIST_LENGTH_MASK;
+                uint8_t const key   = autocorrect_char_index(typo_buffer[i--]);
+                uint8_t       j     = 0;
+                while (pgm_read_byte(autocorrect_data + state + 1 + j) != key) {
+                    if (++j >= count) {
+                        return 0;
+                    }
+                }
+                state = autocorrect_read_link(state + 1 + count + j * AUTOCORRECT_LINK_SIZE);
+                break;
+            }
+            case AUTOCORRECT_NODE_TABLE: {
+                uint8_t const key    = autocorrect_char_index(typo_buffer[i--]);
+                uint32_t      bitmap = 0;
+                for (uint8_t j = 0; j < AUTOCORRECT_TABLE_BITMAP_SIZE; ++j) {
+                    bitmap |= (uint32_t)pgm_read_byte(autocorrect_data + state + 1 + j) << (8 * j);
+                }
+                if (!(bitmap & ((uint32_t)1 << key))) {
+                    return 0;
+                }
+                // Children are linked in the order of their chars, so the child's link comes after one for each lower bit set.
+                uint8_t const index = __builtin_popcountl(bitmap & (((uint32_t)1 << key) - 1));
+                state               = autocorrect_read_link(state + 1 + AUTOCORRECT_TABLE_BITMAP_SIZE + index * AUTOCORRECT_LINK_SIZE);
+                break;
+            }
+            default:
+                return 0;
+        }
+
+        // Stop if `state` becomes an invalid index. This should not normally
+        // happen, it is a safeguard in case of a bug, data corruption, etc.
+        if (state >= DICTIONARY_SIZE) {
+            return 0;
+        }
+
+        if ((pgm_read_byte(autocorrect_data + state) & AUTOCORRECT_NODE_MASK) == AUTOCORRECT_NODE_LEAF) {
+            return state;
+        }
+    }
+    return 0;
+}
+#else
+/**
+ * @brief Walks the trie back from the last key in the typo buffer, for data made before the format had a version
+ *
+ * @return autocorrect_offset_t offset of the leaf for the typo that was found, or 0 if there is none
+ */
+static autocorrect_offset_t autocorrect_find_typo(void) {
+    autocorrect_offset_t state = 0;
+    uint8_t              code  = pgm_read_byte(autocorrect_data + state);
+    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
+        uint8_t const key_i = typo_buffer[i];
+
+        if (code & 64) { // Check for match in node with multiple children.
+            code &= 63;
+            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
+                if (!code) return 0;
+            }
+            // Follow link to child node.
+            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
+            // Check for match in node with single child.
+        } else if (code != key_i) {
+            return 0;
+        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
+            ++state;
+        }
+
+        // Stop if `state` becomes an invalid index. This should not normally
+        // happen, it is a safeguard in case of a bug, data corruption, etc.
+        if (state >= DICTIONARY_SIZE) {
+            return 0;
+        }
+
+        code = pgm_read_byte(autocorrect_data + state);
+
+        if (code & 128) {
+            return state;
+        }
+    }
+    return 0;
+}
+#endif
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -279,96 +445,69 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     }
 
     // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
-    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
-        uint8_t const key_i = typo_buffer[i];
-
-        if (code & 64) { // Check for match in node with multiple children.
-            code &= 63;
-            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
-                if (!code) return true;
+    autocorrect_offset_t state = autocorrect_find_typo();
+    if (state) { // A typo was found! Apply autocorrect.
+        const uint8_t backspaces = (pgm_read_byte(autocorrect_data + state) & 63) + !record->event.pressed;
+        const char *  changes    = (const char *)(autocorrect_data + state + 1);
+
+        /* Gather info about the typo'd word
+         *
+         * Since buffer may contain several words, delimited by spaces, we
+         * iterate from the end to find the start and length of the typo
+         */
+        char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+        uint8_t typo_len   = 0;
+        uint8_t typo_start = 0;
+        bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
+        for (uint8_t i = typo_buffer_size; i > 0; --i) {
+            // stop counting after finding space (unless it is the last thing)
+            if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
+                typo_start = i;
+                break;
             }
-            // Follow link to child node.
-            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
-            // Check for match in node with single child.
-        } else if (code != key_i) {
-            return true;
-        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
-            ++state;
-        }
 
-        // Stop if `state` becomes an invalid index. This should not normally
-        // happen, it is a safeguard in case of a bug, data corruption, etc.
-        if (state >= DICTIONARY_SIZE) {
-            return true;
+            ++typo_len;
         }
 
-        code = pgm_read_byte(autocorrect_data + state);
-
-        if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char *  changes    = (const char *)(autocorrect_data + state + 1);
-
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
+        // when detecting 'typo:', reduce the length of the string by one
+        if (space_last) {
+            --typo_len;
+        }
 
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
+        // convert buffer of keycodes into a string
+        for (uint8_t i = 0; i < typo_len; ++i) {
+            typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
+        }
 
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
+        /* Gather the corrected word
+         *
+         * A) Correction of 'typo:' -- Code takes into account
+         * an extra backspace to delete the space (which we dont copy)
+         * for this reason the offset is correct to "skip" the null terminator
+         *
+         * B) When correcting 'typo' -- Need extra offset for terminator
+         */
+        char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+        uint8_t offset = space_last ? backspaces : backspaces + 1;
+        strcpy(correct, typo);
+        strcpy_P(correct + typo_len - offset, changes);
+
+        if (apply_autocorrect(backspaces, changes, typo, correct)) {
+            for (uint8_t i = 0; i < backspaces; ++i) {
+                tap_code(KC_BSPC);
             }
+            send_string_P(changes);
+        }
 
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+        if (keycode == KC_SPC) {
+            typo_buffer[0]   = KC_SPC;
+            typo_buffer_size = 1;
+            return true;
+        } else {
+            typo_buffer_size = 0;
+            return false;
         }
     }
     return true;
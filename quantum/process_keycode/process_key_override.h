@@ -22,6 +22,10 @@
 #include "action.h"
 #include "action_layer.h"
 
+#ifndef KEY_OVERRIDE_REPEAT_DELAY
+#    define KEY_OVERRIDE_REPEAT_DELAY 500
+#endif
+
 /**
  * Key overrides allow you to send a different key-modifier combination or perform a custom action when a certain modifier-key combination is pressed.
  *
@@ -178,6 +178,9 @@ __attribute__((weak)) void post_process_record_user(uint16_t keycode, keyrecord_
 
 void shutdown_quantum(bool jump_to_bootloader) {
     clear_keyboard();
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_CACHE)
+    dynamic_keymap_flush();
+#endif
 #if defined(MIDI_ENABLE) && defined(MIDI_BASIC)
     process_midi_all_notes_off();
 #endif
@@ -244,159 +247,219 @@ uint16_t get_event_keycode(keyevent_t event, bool update_layer_cache) {
         return keymap_key_to_keycode(layer_switch_get_layer(event.key), event.key);
 }
 
-/* Get keycode, and then process pre tapping functionality */
-bool pre_process_record_quantum(keyrecord_t *record) {
-    uint16_t keycode = get_record_keycode(record, true);
-    return pre_process_record_kb(keycode, record) &&
-#ifdef COMBO_ENABLE
-           process_combo(keycode, record) &&
-#endif
-           true;
-}
-
-/* Get keycode, and then call keyboard function */
-void post_process_record_quantum(keyrecord_t *record) {
-    uint16_t keycode = get_record_keycode(record, false);
-    post_process_record_kb(keycode, record);
+#if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
+static bool process_rgb_record(uint16_t keycode, keyrecord_t *record) {
+    return process_rgb(keycode, record);
 }
-
-/* Core keycode function, hands off handling to other functions,
-    then processes internal quantum keycodes, and then processes
-    ACTIONs.                                                      */
-bool process_record_quantum(keyrecord_t *record) {
-    uint16_t keycode = get_record_keycode(record, true);
-
-    // This is how you use actions here
-    // if (keycode == QK_LEADER) {
-    //   action_t action;
-    //   action.code = ACTION_DEFAULT_LAYER_SET(0);
-    //   process_action(record, action);
-    //   return false;
-    // }
-
-#if defined(SECURE_ENABLE)
-    if (!preprocess_secure(keycode, record)) {
-        return false;
-    }
 #endif
 
-#ifdef TAP_DANCE_ENABLE
-    if (preprocess_tap_dance(keycode, record)) {
-        // The tap dance might have updated the layer state, therefore the
-        // result of the keycode lookup might change.
-        keycode = get_record_keycode(record, true);
-    }
+#ifdef KEY_OVERRIDE_ENABLE
+static bool process_key_override_record(uint16_t keycode, keyrecord_t *record) {
+    return process_key_override(keycode, record);
+}
 #endif
 
-#ifdef RGBLIGHT_ENABLE
-    if (record->event.pressed) {
-        preprocess_rgblight();
-    }
-#endif
+typedef struct {
+    uint16_t first;
+    uint16_t last;
+    bool (*process)(uint16_t keycode, keyrecord_t *record);
+} process_record_handler_t;
 
-#ifdef WPM_ENABLE
-    if (record->event.pressed) {
-        update_wpm(keycode);
-    }
-#endif
+// Handlers that must see every event, e.g. to track state or cancel on other keys
+#define PROCESS_ANY_KEYCODE(process) {0x0000, 0xFFFF, process}
+// Handlers that return true without side effects for anything outside first ... last
+#define PROCESS_KEYCODE_RANGE(first, last, process) {first, last, process}
 
-    if (!(
-#if defined(KEY_LOCK_ENABLE)
-            // Must run first to be able to mask key_up events.
-            process_key_lock(&keycode, record) &&
-#endif
+/* The process_* handlers, in the order they get to see an event. The table is built from the
+ * enabled features at compile time, and an event is only handed to the handlers whose range
+ * covers its keycode.
+ */
+static const process_record_handler_t process_record_handlers[] = {
 #if defined(DYNAMIC_MACRO_ENABLE) && !defined(DYNAMIC_MACRO_USER_CALL)
-            // Must run asap to ensure all keypresses are recorded.
-            process_dynamic_macro(keycode, record) &&
+    // Must run asap to ensure all keypresses are recorded.
+    PROCESS_ANY_KEYCODE(process_dynamic_macro),
 #endif
 #ifdef REPEAT_KEY_ENABLE
-            process_last_key(keycode, record) && process_repeat_key(keycode, record) &&
+    PROCESS_ANY_KEYCODE(process_last_key),
+    PROCESS_ANY_KEYCODE(process_repeat_key),
 #endif
 #if defined(AUDIO_ENABLE) && defined(AUDIO_CLICKY)
-            process_clicky(keycode, record) &&
+    PROCESS_ANY_KEYCODE(process_clicky),
 #endif
 #ifdef HAPTIC_ENABLE
-            process_haptic(keycode, record) &&
+    PROCESS_ANY_KEYCODE(process_haptic),
 #endif
 #if defined(VIA_ENABLE)
-            process_record_via(keycode, record) &&
+    PROCESS_KEYCODE_RANGE(QK_MACRO, QK_MACRO_MAX, process_record_via),
 #endif
 #if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
-            process_auto_mouse(keycode, record) &&
+    PROCESS_ANY_KEYCODE(process_auto_mouse),
 #endif
-            process_record_kb(keycode, record) &&
+    PROCESS_ANY_KEYCODE(process_record_kb),
 #if defined(SECURE_ENABLE)
-            process_secure(keycode, record) &&
+    PROCESS_ANY_KEYCODE(process_secure),
 #endif
 #if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
+    PROCESS_KEYCODE_RANGE(QK_SEQUENCER, QK_SEQUENCER_MAX, process_sequencer),
 #endif
 #if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
+    PROCESS_KEYCODE_RANGE(QK_MIDI, QK_MIDI_MAX, process_midi),
 #endif
 #ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
+    PROCESS_KEYCODE_RANGE(QK_AUDIO, QK_AUDIO_MAX, process_audio),
 #endif
 #if defined(BACKLIGHT_ENABLE)
-            process_backlight(keycode, record) &&
+    PROCESS_KEYCODE_RANGE(QK_BACKLIGHT_ON, QK_BACKLIGHT_TOGGLE_BREATHING, process_backlight),
 #endif
 #if defined(LED_MATRIX_ENABLE)
-            process_led_matrix(keycode, record) &&
+    // Also handles the backlight keycodes
+    PROCESS_KEYCODE_RANGE(QK_BACKLIGHT_ON, QK_LED_MATRIX_SPEED_DOWN, process_led_matrix),
 #endif
 #ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
+    PROCESS_KEYCODE_RANGE(QK_STENO, QK_STENO_MAX, process_steno),
 #endif
 #if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
-            process_music(keycode, record) &&
+    PROCESS_ANY_KEYCODE(process_music),
 #endif
 #ifdef CAPS_WORD_ENABLE
-            process_caps_word(keycode, record) &&
+    PROCESS_ANY_KEYCODE(process_caps_word),
 #endif
 #ifdef KEY_OVERRIDE_ENABLE
-            process_key_override(keycode, record) &&
+    PROCESS_ANY_KEYCODE(process_key_override_record),
 #endif
 #ifdef TAP_DANCE_ENABLE
-            process_tap_dance(keycode, record) &&
+    PROCESS_ANY_KEYCODE(process_tap_dance),
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
-            process_unicode_common(keycode, record) &&
+#    ifdef UCIS_ENABLE
+    // Collects every key while UCIS input is active
+    PROCESS_ANY_KEYCODE(process_unicode_common),
+#    else
+    PROCESS_KEYCODE_RANGE(QK_UNICODE_MODE_NEXT, QK_UNICODE_MODE_EMACS, process_unicode_common),
+    PROCESS_KEYCODE_RANGE(QK_UNICODE, QK_UNICODE_MAX, process_unicode_common),
+#    endif
 #endif
 #ifdef LEADER_ENABLE
-            process_leader(keycode, record) &&
+    PROCESS_ANY_KEYCODE(process_leader),
 #endif
 #ifdef AUTO_SHIFT_ENABLE
-            process_auto_shift(keycode, record) &&
+    PROCESS_ANY_KEYCODE(process_auto_shift),
 #endif
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
+    PROCESS_KEYCODE_RANGE(QK_DYNAMIC_TAPPING_TERM_PRINT, QK_DYNAMIC_TAPPING_TERM_DOWN, process_dynamic_tapping_term),
 #endif
 #ifdef SPACE_CADET_ENABLE
-            process_space_cadet(keycode, record) &&
+    PROCESS_ANY_KEYCODE(process_space_cadet),
 #endif
 #ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
+    PROCESS_KEYCODE_RANGE(QK_MAGIC, QK_MAGIC_MAX, process_magic),
 #endif
 #ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
+    PROCESS_KEYCODE_RANGE(QK_GRAVE_ESCAPE, QK_GRAVE_ESCAPE, process_grave_esc),
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_rgb(keycode, record) &&
+    PROCESS_KEYCODE_RANGE(QK_UNDERGLOW_TOGGLE, QK_RGB_MATRIX_SPEED_DOWN, process_rgb_record),
 #endif
 #ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
+    PROCESS_KEYCODE_RANGE(QK_JOYSTICK, QK_JOYSTICK_MAX, process_joystick),
 #endif
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
+    PROCESS_KEYCODE_RANGE(QK_PROGRAMMABLE_BUTTON, QK_PROGRAMMABLE_BUTTON_MAX, process_programmable_button),
 #endif
 #ifdef AUTOCORRECT_ENABLE
-            process_autocorrect(keycode, record) &&
+    PROCESS_ANY_KEYCODE(process_autocorrect),
 #endif
 #ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
+    PROCESS_KEYCODE_RANGE(QK_TRI_LAYER_LOWER, QK_TRI_LAYER_UPPER, process_tri_layer),
+#endif
+};
+
+#ifdef DEBUG_PROCESS_RECORD_HANDLERS
+static uint8_t process_record_handler_count = 0;
+
+uint8_t get_process_record_handler_count(void) {
+    return process_record_handler_count;
+}
 #endif
-            true)) {
+
+/* Get keycode, and then process pre tapping functionality */
+bool pre_process_record_quantum(keyrecord_t *record) {
+    uint16_t keycode = get_record_keycode(record, true);
+    return pre_process_record_kb(keycode, record) &&
+#ifdef COMBO_ENABLE
+           process_combo(keycode, record) &&
+#endif
+           true;
+}
+
+/* Get keycode, and then call keyboard function */
+void post_process_record_quantum(keyrecord_t *record) {
+    uint16_t keycode = get_record_keycode(record, false);
+    post_process_record_kb(keycode, record);
+}
+
+/* Core keycode function, hands off handling to other functions,
+    then processes internal quantum keycodes, and then processes
+    ACTIONs.                                                      */
+bool process_record_quantum(keyrecord_t *record) {
+    uint16_t keycode = get_record_keycode(record, true);
+
+    // This is how you use actions here
+    // if (keycode == QK_LEADER) {
+    //   action_t action;
+    //   action.code = ACTION_DEFAULT_LAYER_SET(0);
+    //   process_action(record, action);
+    //   return false;
+    // }
+
+#if defined(SECURE_ENABLE)
+    if (!preprocess_secure(keycode, record)) {
         return false;
     }
+#endif
+
+#ifdef TAP_DANCE_ENABLE
+    if (preprocess_tap_dance(keycode, record)) {
+        // The tap dance might have updated the layer state, therefore the
+        // result of the keycode lookup might change.
+        keycode = get_record_keycode(record, true);
+    }
+#endif
+
+#ifdef RGBLIGHT_ENABLE
+    if (record->event.pressed) {
+        preprocess_rgblight();
+    }
+#endif
+
+#ifdef WPM_ENABLE
+    if (record->event.pressed) {
+        update_wpm(keycode);
+    }
+#endif
+
+#if defined(KEY_LOCK_ENABLE)
+    // Must run first to be able to mask key_up events.
+    if (!process_key_lock(&keycode, record)) {
+        return false;
+    }
+#endif
+
+#ifdef DEBUG_PROCESS_RECORD_HANDLERS
+    process_record_handler_count = 0;
+#endif
+    for (uint8_t i = 0; i < ARRAY_SIZE(process_record_handlers); i++) {
+        const process_record_handler_t *handler = &process_record_handlers[i];
+        if (keycode < handler->first || keycode > handler->last) {
+            continue;
+        }
+#ifdef DEBUG_PROCESS_RECORD_HANDLERS
+        process_record_handler_count++;
+#endif
+        if (!handler->process(keycode, record)) {
+            return false;
+        }
+    }
 
     if (record->event.pressed) {
         switch (keycode) {
@@ -259,6 +259,11 @@ bool     process_record_user(uint16_t keycode, keyrecord_t *record);
 void     post_process_record_kb(uint16_t keycode, keyrecord_t *record);
 void     post_process_record_user(uint16_t keycode, keyrecord_t *record);
 
+#ifdef DEBUG_PROCESS_RECORD_HANDLERS
+// Number of process_* handlers the last event was handed to
+uint8_t get_process_record_handler_count(void);
+#endif
+
 void reset_keyboard(void);
 void soft_reset_keyboard(void);
 
@@ -39,6 +39,11 @@ __attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
     return hsv_to_rgb(hsv);
 }
 
+#ifdef RGB_MATRIX_FAST_RUNNERS
+// distance of each LED from the centre, calculated from g_led_config by rgb_matrix_update_led_dist()
+uint8_t g_rgb_matrix_led_dist[RGB_MATRIX_LED_COUNT];
+#endif
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -83,6 +88,13 @@ static uint32_t rgb_timer_buffer;
 static last_hit_t last_hit_buffer;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+// the frame being drawn, and the colours last handed to the driver
+static RGB  rgb_matrix_frame[RGB_MATRIX_LED_COUNT];
+static RGB  rgb_matrix_shadow[RGB_MATRIX_LED_COUNT];
+static bool rgb_matrix_force_flush = false;
+#endif // RGB_MATRIX_DIRTY_TRACKING
+
 // split rgb matrix
 #if defined(RGB_MATRIX_SPLIT)
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
@@ -140,15 +152,41 @@ uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
 }
 
 void rgb_matrix_update_pwm_buffers(void) {
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    // only the LEDs that differ from the last flush reach the driver, so an LED drawn over
+    // within a frame, such as an indicator on top of an effect, is not sent again every frame
+    bool changed           = rgb_matrix_force_flush;
+    rgb_matrix_force_flush = false;
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        RGB rgb = rgb_matrix_frame[i];
+        if (rgb.r == rgb_matrix_shadow[i].r && rgb.g == rgb_matrix_shadow[i].g && rgb.b == rgb_matrix_shadow[i].b) {
+            continue;
+        }
+        rgb_matrix_shadow[i] = rgb;
+        rgb_matrix_driver.set_color(i, rgb.r, rgb.g, rgb.b);
+        changed = true;
+    }
+
+    // nothing changed since the last flush, so there is nothing to send
+    if (!changed) {
+        return;
+    }
+#endif
     rgb_matrix_driver.flush();
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
+        rgb_matrix_frame[index] = (RGB){.r = red, .g = green, .b = blue};
+    }
+#else
     rgb_matrix_driver.set_color(index, red, green, blue);
+#endif
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
-#if defined(RGB_MATRIX_SPLIT)
+#if defined(RGB_MATRIX_SPLIT) || defined(RGB_MATRIX_DIRTY_TRACKING)
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
@@ -445,9 +483,30 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
     return true;
 }
 
+#ifdef RGB_MATRIX_FAST_RUNNERS
+void rgb_matrix_update_led_dist(void) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx               = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy               = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        g_rgb_matrix_led_dist[i] = sqrt16(dx * dx + dy * dy);
+    }
+}
+#endif
+
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+#ifdef RGB_MATRIX_FAST_RUNNERS
+    rgb_matrix_update_led_dist();
+#endif
+
+#ifdef RGB_MATRIX_DIRTY_TRACKING
+    // the driver starts out dark, flush it once regardless
+    memset(rgb_matrix_frame, 0, sizeof(rgb_matrix_frame));
+    memset(rgb_matrix_shadow, 0, sizeof(rgb_matrix_shadow));
+    rgb_matrix_force_flush = true;
+#endif
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
@@ -164,6 +164,11 @@ bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
 void rgb_matrix_init(void);
 
+#ifdef RGB_MATRIX_FAST_RUNNERS
+// Recalculates each LED's distance from the centre, for when g_led_config is changed after rgb_matrix_init()
+void rgb_matrix_update_led_dist(void);
+#endif
+
 void rgb_matrix_reload_from_eeprom(void);
 
 void        rgb_matrix_set_suspend_state(bool state);
@@ -277,3 +282,6 @@ extern last_hit_t g_last_hit_tracker;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
+#ifdef RGB_MATRIX_FAST_RUNNERS
+extern uint8_t g_rgb_matrix_led_dist[RGB_MATRIX_LED_COUNT];
+#endif
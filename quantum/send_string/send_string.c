@@ -24,6 +24,11 @@
 #include "action.h"
 #include "wait.h"
 
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include "host.h"
+#    include "timer.h"
+#endif
+
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
 #    ifndef BELL_SOUND
@@ -336,3 +341,236 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
     }
 }
 #endif
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+typedef struct {
+    const char                  *string;
+    send_string_async_callback_t callback;
+    void                        *cb_arg;
+    uint8_t                      interval;
+    bool                         progmem;
+} send_string_async_job_t;
+
+// A character is typed as a series of steps, each followed by a delay before the next one
+typedef enum {
+    SEND_STRING_ASYNC_REGISTER,
+    SEND_STRING_ASYNC_UNREGISTER,
+    SEND_STRING_ASYNC_WAIT,
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    SEND_STRING_ASYNC_BELL,
+#    endif
+} send_string_async_action_t;
+
+typedef struct {
+    uint8_t  action;
+    uint8_t  keycode;
+    uint16_t delay;
+} send_string_async_step_t;
+
+// Shift, AltGr, the key itself and a dead key's space, each pressed and released
+#    define SEND_STRING_ASYNC_MAX_STEPS 8
+
+static send_string_async_job_t  async_jobs[SEND_STRING_ASYNC_QUEUE_SIZE];
+static uint8_t                  async_job_head  = 0;
+static uint8_t                  async_job_count = 0;
+static send_string_async_step_t async_steps[SEND_STRING_ASYNC_MAX_STEPS];
+static uint8_t                  async_step_count = 0;
+static uint8_t                  async_step_index = 0;
+static uint32_t                 async_step_timer = 0;
+static uint16_t                 async_step_delay = 0;
+
+static bool send_string_async_enqueue(const char *string, uint8_t interval, bool progmem, send_string_async_callback_t callback, void *cb_arg) {
+    if (async_job_count == SEND_STRING_ASYNC_QUEUE_SIZE) {
+        return false;
+    }
+
+    async_jobs[(async_job_head + async_job_count) % SEND_STRING_ASYNC_QUEUE_SIZE] = (send_string_async_job_t){
+        .string   = string,
+        .callback = callback,
+        .cb_arg   = cb_arg,
+        .interval = interval,
+        .progmem  = progmem,
+    };
+    async_job_count++;
+    return true;
+}
+
+bool send_string_async(const char *string, send_string_async_callback_t callback, void *cb_arg) {
+    return send_string_with_delay_async(string, TAP_CODE_DELAY, callback, cb_arg);
+}
+
+bool send_string_with_delay_async(const char *string, uint8_t interval, send_string_async_callback_t callback, void *cb_arg) {
+    return send_string_async_enqueue(string, interval, false, callback, cb_arg);
+}
+
+#    if defined(__AVR__)
+bool send_string_with_delay_async_P(const char *string, uint8_t interval, send_string_async_callback_t callback, void *cb_arg) {
+    return send_string_async_enqueue(string, interval, true, callback, cb_arg);
+}
+#    endif
+
+bool send_string_async_in_progress(void) {
+    return async_job_count > 0;
+}
+
+static inline char send_string_async_read(const send_string_async_job_t *job) {
+    return job->progmem ? pgm_read_byte(job->string) : *job->string;
+}
+
+static void send_string_async_add_step(uint8_t action, uint8_t keycode, uint16_t delay) {
+    async_steps[async_step_count++] = (send_string_async_step_t){.action = action, .keycode = keycode, .delay = delay};
+}
+
+// Breaks the next character or escape code of the string into steps, mirroring send_string_with_delay()
+static bool send_string_async_decode(send_string_async_job_t *job) {
+    uint8_t interval   = job->interval;
+    char    ascii_code = send_string_async_read(job);
+    if (!ascii_code) {
+        return false;
+    }
+
+    async_step_count = 0;
+    async_step_index = 0;
+
+    if (ascii_code == SS_QMK_PREFIX) {
+        job->string++;
+        ascii_code = send_string_async_read(job);
+
+        if (ascii_code == SS_TAP_CODE) {
+            job->string++;
+            uint8_t keycode = send_string_async_read(job);
+            send_string_async_add_step(SEND_STRING_ASYNC_REGISTER, keycode, keycode == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY);
+            send_string_async_add_step(SEND_STRING_ASYNC_UNREGISTER, keycode, interval);
+        } else if (ascii_code == SS_DOWN_CODE) {
+            job->string++;
+            send_string_async_add_step(SEND_STRING_ASYNC_REGISTER, send_string_async_read(job), interval);
+        } else if (ascii_code == SS_UP_CODE) {
+            job->string++;
+            send_string_async_add_step(SEND_STRING_ASYNC_UNREGISTER, send_string_async_read(job), interval);
+        } else if (ascii_code == SS_DELAY_CODE) {
+            uint16_t ms = 0;
+            job->string++;
+            while (isdigit(send_string_async_read(job))) {
+                ms = ms * 10 + send_string_async_read(job) - '0';
+                job->string++;
+            }
+            send_string_async_add_step(SEND_STRING_ASYNC_WAIT, KC_NO, ms + interval);
+        } else {
+            send_string_async_add_step(SEND_STRING_ASYNC_WAIT, KC_NO, interval);
+        }
+    } else {
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+        if (ascii_code == '\a') { // BEL
+            send_string_async_add_step(SEND_STRING_ASYNC_BELL, KC_NO, 0);
+            job->string++;
+            return true;
+        }
+#    endif
+
+        uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+        bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+        bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+        bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+
+        if (is_shifted) {
+            send_string_async_add_step(SEND_STRING_ASYNC_REGISTER, KC_LEFT_SHIFT, interval);
+        }
+        if (is_altgred) {
+            send_string_async_add_step(SEND_STRING_ASYNC_REGISTER, KC_RIGHT_ALT, interval);
+        }
+        send_string_async_add_step(SEND_STRING_ASYNC_REGISTER, keycode, interval);
+        send_string_async_add_step(SEND_STRING_ASYNC_UNREGISTER, keycode, interval);
+        if (is_altgred) {
+            send_string_async_add_step(SEND_STRING_ASYNC_UNREGISTER, KC_RIGHT_ALT, interval);
+        }
+        if (is_shifted) {
+            send_string_async_add_step(SEND_STRING_ASYNC_UNREGISTER, KC_LEFT_SHIFT, interval);
+        }
+        if (is_dead) {
+            send_string_async_add_step(SEND_STRING_ASYNC_REGISTER, KC_SPACE, TAP_CODE_DELAY);
+            send_string_async_add_step(SEND_STRING_ASYNC_UNREGISTER, KC_SPACE, interval);
+        }
+    }
+
+    job->string++;
+    return true;
+}
+
+static void send_string_async_perform(const send_string_async_step_t *step) {
+    switch (step->action) {
+        case SEND_STRING_ASYNC_REGISTER:
+            register_code(step->keycode);
+            break;
+        case SEND_STRING_ASYNC_UNREGISTER:
+            unregister_code(step->keycode);
+            break;
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+        case SEND_STRING_ASYNC_BELL:
+            PLAY_SONG(bell_song);
+            break;
+#    endif
+        default:
+            break;
+    }
+}
+
+void send_string_async_task(void) {
+    bool performed = false;
+
+    while (async_job_count > 0) {
+        if (async_step_delay > 0) {
+            if (timer_elapsed32(async_step_timer) < async_step_delay) {
+                return;
+            }
+            async_step_delay = 0;
+        }
+
+        if (async_step_index == async_step_count) {
+            // At most one character is typed per pass, so a long string without delays still lets the keyboard scan
+            if (performed) {
+                return;
+            }
+
+            send_string_async_job_t *job = &async_jobs[async_job_head];
+            if (!send_string_async_decode(job)) {
+                send_string_async_callback_t callback = job->callback;
+                void                        *cb_arg   = job->cb_arg;
+                async_job_head                        = (async_job_head + 1) % SEND_STRING_ASYNC_QUEUE_SIZE;
+                async_job_count--;
+                async_step_count = async_step_index = 0;
+                if (callback) {
+                    callback(cb_arg);
+                }
+                continue;
+            }
+        }
+
+        // Hold back key presses until the host has caught up with the reports already sent
+        const send_string_async_step_t *step = &async_steps[async_step_index];
+        if (step->action != SEND_STRING_ASYNC_WAIT && !host_keyboard_ready()) {
+            return;
+        }
+
+        send_string_async_perform(step);
+        async_step_index++;
+        performed = true;
+        if (step->delay > 0) {
+            async_step_timer = timer_read32();
+            async_step_delay = step->delay;
+        }
+    }
+}
+
+void send_string_async_cancel(void) {
+    // Finish the character being typed, so that none of its keys are left held down
+    while (async_step_index < async_step_count) {
+        send_string_async_perform(&async_steps[async_step_index++]);
+    }
+
+    async_job_head   = 0;
+    async_job_count  = 0;
+    async_step_count = 0;
+    async_step_index = 0;
+    async_step_delay = 0;
+}
+#endif
@@ -23,6 +23,7 @@
  * \{
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "progmem.h"
@@ -161,4 +162,84 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 #define SEND_STRING_DELAY(string, interval) send_string_with_delay_P(PSTR(string), interval)
 
+#if defined(SEND_STRING_ASYNC_ENABLE) || defined(__DOXYGEN__)
+
+#    ifndef SEND_STRING_ASYNC_QUEUE_SIZE
+/**
+ * \brief The maximum number of strings waiting to be typed asynchronously, including the one being typed.
+ */
+#        define SEND_STRING_ASYNC_QUEUE_SIZE 4
+#    endif
+
+/**
+ * \brief Callback invoked once an asynchronously sent string has been typed out.
+ *
+ * \param cb_arg The argument supplied when the string was queued.
+ */
+typedef void (*send_string_async_callback_t)(void *cb_arg);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out from the main loop, without waiting for it.
+ *
+ * This function simply calls `send_string_with_delay_async(string, TAP_CODE_DELAY, callback, cb_arg)`.
+ *
+ * \param string The string to type out. It is read as it is typed, so it must remain valid until the callback is invoked.
+ * \param callback The function to invoke once the string has been typed out, may be NULL.
+ * \param cb_arg The argument to supply to the callback.
+ * \return `false` if the queue is full, in which case nothing is typed.
+ */
+bool send_string_async(const char *string, send_string_async_callback_t callback, void *cb_arg);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out from the main loop, with a delay between each character.
+ *
+ * Characters are broken into the same presses and releases as by `send_string_with_delay()`, and `interval` is waited
+ * after each of them, Shift and AltGr included. Each one is sent from a separate pass of the main loop, so the keyboard
+ * keeps scanning while the string is typed, and an `SS_DELAY()` only delays the rest of the string. With the
+ * `USB_REPORT_QUEUE_ENABLE` rules.mk option, the next press or release also waits until the host has received the
+ * previous reports.
+ *
+ * \param string The string to type out. It is read as it is typed, so it must remain valid until the callback is invoked.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ * \param callback The function to invoke once the string has been typed out, may be NULL.
+ * \param cb_arg The argument to supply to the callback.
+ * \return `false` if the queue is full, in which case nothing is typed.
+ */
+bool send_string_with_delay_async(const char *string, uint8_t interval, send_string_async_callback_t callback, void *cb_arg);
+
+#    if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out from the main loop, with a delay between each character.
+ *
+ * On ARM devices, this function is simply an alias for send_string_with_delay_async(string, interval, callback, cb_arg).
+ */
+bool send_string_with_delay_async_P(const char *string, uint8_t interval, send_string_async_callback_t callback, void *cb_arg);
+#    else
+#        define send_string_with_delay_async_P(string, interval, callback, cb_arg) send_string_with_delay_async(string, interval, callback, cb_arg)
+#    endif
+
+/**
+ * \brief Shortcut macro for send_string_with_delay_async_P(PSTR(string), TAP_CODE_DELAY, NULL, NULL).
+ */
+#    define SEND_STRING_ASYNC(string) send_string_with_delay_async_P(PSTR(string), TAP_CODE_DELAY, NULL, NULL)
+
+/**
+ * \brief Check whether any queued string is still being typed out.
+ */
+bool send_string_async_in_progress(void);
+
+/**
+ * \brief Drop every queued string, without invoking their callbacks.
+ *
+ * The character being typed is finished first, so that none of its keys are left held down.
+ */
+void send_string_async_cancel(void);
+
+/**
+ * \brief Types out the queued strings, called from the main loop.
+ */
+void send_string_async_task(void);
+
+#endif
+
 /** \} */
@@ -0,0 +1,22 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 4
+
+#define SPLIT_KEYBOARD
+#define PLATFORM_SUPPORTS_SYNCHRONIZATION
+#define DISABLE_SYNC_TIMER
+#define NO_ACTION_ONESHOT
+
+#define LAYER_STATE_32BIT
+#define SPLIT_LAYER_STATE_ENABLE
+#define SPLIT_LED_STATE_ENABLE
+#define SPLIT_MODS_ENABLE
+#define SPLIT_ACTIVITY_ENABLE
+
+// Room for a raw layer state record, but not for a raw activity record
+#define SPLIT_TRANSACTION_BATCHING
+#define SPLIT_TRANSACTION_BATCH_SIZE 8
@@ -0,0 +1,20 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 4
+
+#define SPLIT_KEYBOARD
+#define PLATFORM_SUPPORTS_SYNCHRONIZATION
+#define DISABLE_SYNC_TIMER
+#define NO_ACTION_ONESHOT
+
+#define SPLIT_LAYER_STATE_ENABLE
+#define SPLIT_LED_STATE_ENABLE
+#define SPLIT_MODS_ENABLE
+
+#define SPLIT_SYNC_SCHEDULER
+#define SPLIT_SYNC_UPDATE_BUDGET 1
+#define SPLIT_SYNC_COSMETIC_DEADLINE_MS 50
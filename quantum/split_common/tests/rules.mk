@@ -0,0 +1,28 @@
+split_transaction_batch_DEFS := -DNO_DEBUG
+split_transaction_batch_INC := $(QUANTUM_PATH)/split_common
+
+split_transaction_batch_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/transaction_batch_tests.cpp \
+	$(QUANTUM_PATH)/split_common/transaction_batch.c \
+	$(QUANTUM_PATH)/crc.c
+
+split_sync_scheduler_DEFS := -DNO_DEBUG
+split_sync_scheduler_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_sync_scheduler.h
+split_sync_scheduler_INC := $(QUANTUM_PATH)/split_common
+
+split_sync_scheduler_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/sync_scheduler_tests.cpp \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/crc.c \
+	platforms/test/timer.c
+
+split_transaction_batch_loopback_DEFS := -DNO_DEBUG
+split_transaction_batch_loopback_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_batch_loopback.h
+split_transaction_batch_loopback_INC := $(QUANTUM_PATH)/split_common
+
+split_transaction_batch_loopback_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/transaction_batch_loopback_tests.cpp \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transaction_batch.c \
+	$(QUANTUM_PATH)/crc.c \
+	platforms/test/timer.c
@@ -0,0 +1,163 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+
+// The transaction headers are written for C
+#define _Static_assert static_assert
+
+extern "C" {
+#include "transactions.h"
+#include "transport.h"
+#include "transaction_id_define.h"
+#include "crc.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+/* The transport is replaced by a log of the transactions the master runs. Writes land in the shared
+ * memory as they would on the slave, and the slave's matrix is read from slave_rows. With a budget of
+ * a single update per sync, any key data leaves nothing for cosmetic data. */
+
+static split_shared_memory_t shmem;
+static std::vector<int8_t>   transactions;
+static matrix_row_t          slave_rows[MATRIX_ROWS / 2];
+static matrix_row_t          master_matrix[MATRIX_ROWS / 2];
+static matrix_row_t          slave_matrix[MATRIX_ROWS / 2];
+static uint8_t               keyboard_leds;
+static uint8_t               mods;
+
+extern "C" {
+split_shared_memory_t *const split_shmem = &shmem;
+
+layer_state_t layer_state;
+layer_state_t default_layer_state;
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+void split_shared_memory_lock(void) {}
+void split_shared_memory_unlock(void) {}
+
+uint8_t host_keyboard_leds(void) {
+    return keyboard_leds;
+}
+void set_split_host_keyboard_leds(uint8_t led_state) {}
+
+uint8_t get_mods(void) {
+    return mods;
+}
+uint8_t get_weak_mods(void) {
+    return 0;
+}
+void set_mods(uint8_t mods) {}
+void set_weak_mods(uint8_t mods) {}
+
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    transactions.push_back(id);
+    if (initiator2target_length) {
+        memcpy(split_trans_initiator2target_buffer(&split_transaction_table[id]), initiator2target_buf, initiator2target_length);
+    }
+    if (id == GET_SLAVE_MATRIX_CHECKSUM) {
+        *(uint8_t *)target2initiator_buf = crc8(slave_rows, sizeof(slave_rows));
+    } else if (id == GET_SLAVE_MATRIX_DATA) {
+        memcpy(shmem.smatrix.matrix, slave_rows, sizeof(slave_rows));
+        memcpy(target2initiator_buf, slave_rows, sizeof(slave_rows));
+    }
+    return true;
+}
+}
+
+class SplitSyncScheduler : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // Lets every handler's forced sync and the overdue round through, so each test starts settled
+        advance_time(1000);
+        for (int i = 0; i < 20; i++) {
+            ASSERT_TRUE(transactions_master(master_matrix, slave_matrix));
+        }
+        transactions.clear();
+        transactions_sync_stats_reset();
+    }
+
+    void sync() {
+        ASSERT_TRUE(transactions_master(master_matrix, slave_matrix));
+    }
+
+    bool sent(int8_t id) {
+        for (int8_t t : transactions) {
+            if (t == id) return true;
+        }
+        return false;
+    }
+
+    uint32_t updates(split_sync_class_t sync_class) {
+        return transactions_sync_stats(sync_class)->updates;
+    }
+};
+
+TEST_F(SplitSyncScheduler, ChecksumPollsAreNotCounted) {
+    sync();
+    EXPECT_EQ(transactions, std::vector<int8_t>{GET_SLAVE_MATRIX_CHECKSUM});
+    EXPECT_EQ(updates(SPLIT_SYNC_CLASS_REALTIME), 0u);
+
+    slave_rows[0] ^= 1;
+    sync();
+    EXPECT_TRUE(sent(GET_SLAVE_MATRIX_DATA));
+    EXPECT_EQ(updates(SPLIT_SYNC_CLASS_REALTIME), 1u);
+}
+
+TEST_F(SplitSyncScheduler, CosmeticDataSharesTheBudget) {
+    layer_state ^= 2;
+    keyboard_leds ^= 1;
+    mods ^= 2;
+
+    sync();
+    EXPECT_TRUE(sent(PUT_LAYER_STATE));
+    EXPECT_FALSE(sent(PUT_LED_STATE));
+    EXPECT_FALSE(sent(PUT_MODS));
+
+    sync();
+    EXPECT_TRUE(sent(PUT_LED_STATE));
+    EXPECT_FALSE(sent(PUT_MODS));
+
+    sync();
+    EXPECT_TRUE(sent(PUT_MODS));
+    EXPECT_EQ(updates(SPLIT_SYNC_CLASS_COSMETIC), 3u);
+    EXPECT_EQ(shmem.layers.layer_state, layer_state);
+    EXPECT_EQ(shmem.led_state, keyboard_leds);
+    EXPECT_EQ(shmem.mods.real_mods, mods);
+}
+
+TEST_F(SplitSyncScheduler, KeyDataDefersCosmeticDataUntilTheDeadline) {
+    mods ^= 4;
+
+    // Key data changes on every sync, so mods only get through once the round is overdue
+    uint32_t elapsed = 0;
+    for (;; elapsed += 5) {
+        slave_rows[1] ^= 1;
+        sync();
+        if (sent(PUT_MODS)) break;
+        ASSERT_LT(elapsed, (uint32_t)SPLIT_SYNC_COSMETIC_DEADLINE_MS);
+        advance_time(5);
+    }
+    EXPECT_EQ(elapsed, (uint32_t)SPLIT_SYNC_COSMETIC_DEADLINE_MS);
+    EXPECT_GT(transactions_sync_stats(SPLIT_SYNC_CLASS_COSMETIC)->deferred, 0u);
+    EXPECT_EQ(shmem.mods.real_mods, mods);
+}
+
+TEST_F(SplitSyncScheduler, RateSaturates) {
+    for (int i = 0; i < 70; i++) {
+        slave_rows[0] ^= 1;
+        sync();
+    }
+    advance_time(1);
+    EXPECT_EQ(transactions_sync_rate(SPLIT_SYNC_CLASS_REALTIME), UINT16_MAX);
+
+    advance_time(999);
+    EXPECT_EQ(transactions_sync_rate(SPLIT_SYNC_CLASS_REALTIME), 70u);
+}
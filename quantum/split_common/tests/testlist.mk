@@ -0,0 +1,3 @@
+TEST_LIST += split_transaction_batch
+TEST_LIST += split_sync_scheduler
+TEST_LIST += split_transaction_batch_loopback
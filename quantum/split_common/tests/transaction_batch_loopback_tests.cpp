@@ -0,0 +1,240 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+
+// The transaction headers are written for C
+#define _Static_assert static_assert
+
+extern "C" {
+#include "transactions.h"
+#include "transport.h"
+#include "transaction_id_define.h"
+#include "transaction_batch.h"
+#include "crc.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+/* A loopback of the split transport through transactions.c: the master and the slave each have their
+ * own shared memory, and running a transaction swaps the slave's in, copies the master's buffer to it
+ * and calls the slave callback, as the real transports do. The batch frame is too small for a raw
+ * activity record, which therefore goes through as a transaction of its own. */
+
+static split_shared_memory_t shmem, master_memory, slave_memory;
+static std::vector<int8_t>   transactions;
+static std::vector<uint8_t>  last_frame;
+static bool                  drop_batches;
+static matrix_row_t          master_matrix[MATRIX_ROWS / 2];
+static matrix_row_t          slave_matrix[MATRIX_ROWS / 2];
+static uint8_t               keyboard_leds;
+static uint8_t               mods;
+static uint32_t              matrix_activity;
+
+extern "C" {
+split_shared_memory_t *const split_shmem = &shmem;
+
+layer_state_t layer_state;
+layer_state_t default_layer_state;
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+void split_shared_memory_lock(void) {}
+void split_shared_memory_unlock(void) {}
+
+uint8_t host_keyboard_leds(void) {
+    return keyboard_leds;
+}
+void set_split_host_keyboard_leds(uint8_t led_state) {}
+
+uint8_t get_mods(void) {
+    return mods;
+}
+uint8_t get_weak_mods(void) {
+    return 0;
+}
+void set_mods(uint8_t mods) {}
+void set_weak_mods(uint8_t mods) {}
+
+uint32_t last_matrix_activity_time(void) {
+    return matrix_activity;
+}
+uint32_t last_encoder_activity_time(void) {
+    return 0;
+}
+uint32_t last_pointing_device_activity_time(void) {
+    return 0;
+}
+void set_activity_timestamps(uint32_t matrix_timestamp, uint32_t encoder_timestamp, uint32_t pointing_device_timestamp) {}
+
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    transactions.push_back(id);
+    if (id == PUT_BATCH && drop_batches) {
+        return false;
+    }
+
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    std::vector<uint8_t>      sent((const uint8_t *)initiator2target_buf, (const uint8_t *)initiator2target_buf + initiator2target_length);
+    if (id == PUT_BATCH) {
+        last_frame = sent;
+    }
+
+    // The master keeps a copy of what it sent
+    if (initiator2target_length) {
+        memcpy(split_trans_initiator2target_buffer(trans), sent.data(), initiator2target_length);
+    }
+    master_memory = shmem;
+    shmem         = slave_memory;
+
+    if (initiator2target_length) {
+        memcpy(split_trans_initiator2target_buffer(trans), sent.data(), initiator2target_length);
+    }
+    if (id == GET_SLAVE_MATRIX_CHECKSUM) {
+        shmem.smatrix.checksum = crc8(shmem.smatrix.matrix, sizeof(shmem.smatrix.matrix));
+    }
+    if (trans->slave_callback) {
+        trans->slave_callback(initiator2target_length, split_trans_initiator2target_buffer(trans), target2initiator_length, split_trans_target2initiator_buffer(trans));
+    }
+    if (target2initiator_length) {
+        memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), target2initiator_length);
+    }
+
+    slave_memory = shmem;
+    shmem        = master_memory;
+    return true;
+}
+}
+
+class SplitTransactionBatchLoopback : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        drop_batches = false;
+        // Lets every handler's forced sync through, so each test starts settled
+        advance_time(1000);
+        for (int i = 0; i < 5; i++) {
+            sync();
+        }
+        expect_slave_in_sync();
+        transactions.clear();
+    }
+
+    void sync() {
+        ASSERT_TRUE(transactions_master(master_matrix, slave_matrix));
+    }
+
+    unsigned sent(int8_t id) {
+        unsigned count = 0;
+        for (int8_t t : transactions) {
+            count += t == id;
+        }
+        return count;
+    }
+
+    // Whether the last frame carried a raw record for the transaction
+    bool sent_raw(int8_t id) {
+        for (size_t pos = SPLIT_BATCH_HEADER_SIZE; pos < last_frame.size();) {
+            uint8_t record = last_frame[pos++];
+            uint8_t length = split_transaction_table[record & ~SPLIT_BATCH_RAW].initiator2target_buffer_size;
+            if ((record & ~SPLIT_BATCH_RAW) == id) {
+                return record & SPLIT_BATCH_RAW;
+            }
+            if (!(record & SPLIT_BATCH_RAW)) {
+                ADD_FAILURE() << "only expected a single delta record";
+                return false;
+            }
+            pos += length;
+        }
+        ADD_FAILURE() << "no record for transaction " << (int)id;
+        return false;
+    }
+
+    void expect_slave_in_sync() {
+        EXPECT_EQ(slave_memory.layers.layer_state, layer_state);
+        EXPECT_EQ(slave_memory.layers.default_layer_state, default_layer_state);
+        EXPECT_EQ(slave_memory.led_state, keyboard_leds);
+        EXPECT_EQ(slave_memory.mods.real_mods, mods);
+        EXPECT_EQ(slave_memory.activity_sync.matrix_timestamp, matrix_activity);
+    }
+};
+
+TEST_F(SplitTransactionBatchLoopback, UpdatesAreBatched) {
+    layer_state ^= 0x02;
+    sync();
+    EXPECT_EQ(sent(PUT_BATCH), 1u);
+    EXPECT_EQ(sent(PUT_LAYER_STATE), 0u);
+    EXPECT_FALSE(sent_raw(PUT_LAYER_STATE));
+    expect_slave_in_sync();
+
+    // A raw LED state record doesn't fit next to the layer state delta, so it starts a second frame
+    transactions.clear();
+    layer_state ^= 0x04;
+    keyboard_leds ^= 0x01;
+    sync();
+    EXPECT_EQ(sent(PUT_BATCH), 2u);
+    EXPECT_EQ(sent(PUT_LED_STATE), 0u);
+    expect_slave_in_sync();
+}
+
+TEST_F(SplitTransactionBatchLoopback, TooLargeRecordIsSentOnItsOwn) {
+    matrix_activity += 5;
+    sync();
+    EXPECT_EQ(sent(PUT_ACTIVITY), 1u);
+    EXPECT_EQ(sent(PUT_BATCH), 0u);
+    expect_slave_in_sync();
+
+    transactions.clear();
+    matrix_activity += 5;
+    sync();
+    EXPECT_EQ(sent(PUT_ACTIVITY), 1u);
+    expect_slave_in_sync();
+}
+
+TEST_F(SplitTransactionBatchLoopback, FailedFlushIsResentRaw) {
+    drop_batches = true;
+    layer_state ^= 0x02;
+    EXPECT_FALSE(transactions_master(master_matrix, slave_matrix));
+    drop_batches = false;
+
+    // The slave never got the first change, so the next one can't be a delta against it
+    layer_state ^= 0x04;
+    sync();
+    EXPECT_TRUE(sent_raw(PUT_LAYER_STATE));
+    expect_slave_in_sync();
+
+    layer_state ^= 0x08;
+    sync();
+    EXPECT_FALSE(sent_raw(PUT_LAYER_STATE));
+    expect_slave_in_sync();
+}
+
+TEST_F(SplitTransactionBatchLoopback, SlaveResetIsResentRaw) {
+    layer_state ^= 0x02;
+    sync();
+    expect_slave_in_sync();
+
+    // The slave starts again with zeroed memory, while the master carries on
+    memset(&slave_memory, 0, sizeof(slave_memory));
+    transactions.clear();
+
+    layer_state ^= 0x04;
+    sync();
+    // The delta is refused, and the layer state is sent again raw in the same sync
+    EXPECT_EQ(sent(PUT_BATCH), 2u);
+    EXPECT_TRUE(sent_raw(PUT_LAYER_STATE));
+    EXPECT_EQ(slave_memory.layers.layer_state, layer_state);
+
+    layer_state ^= 0x08;
+    sync();
+    EXPECT_FALSE(sent_raw(PUT_LAYER_STATE));
+    EXPECT_EQ(slave_memory.layers.layer_state, layer_state);
+
+    // Everything else is restored by the next forced sync
+    advance_time(1000);
+    sync();
+    expect_slave_in_sync();
+}
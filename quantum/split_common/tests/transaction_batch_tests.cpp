@@ -0,0 +1,297 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdio>
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "transaction_batch.h"
+}
+
+/* A loopback of the split transport: the initiator and target each have their own copy of the
+ * shared memory, and "transferring" a frame decodes it straight into the target's copy. The regions
+ * mirror the sizes of the usual initiator-to-target transactions. */
+
+enum { MASTER_MATRIX, SYNC_TIMER, LAYER_STATE, DEFAULT_LAYER_STATE, LED_STATE, MODS, RGB_MATRIX, WPM, OLED, ACTIVITY, LARGE, NUM_REGIONS };
+
+static const uint8_t region_size[NUM_REGIONS] = {4, 4, 4, 4, 1, 4, 9, 1, 1, 12, 56};
+
+static const uint8_t frame_size = 64;
+
+static uint8_t initiator[NUM_REGIONS][64];
+static uint8_t target[NUM_REGIONS][64];
+
+static uint8_t *target_region(int8_t id, uint8_t *length) {
+    if (id < 0 || id >= NUM_REGIONS) return NULL;
+    *length = region_size[id];
+    return target[id];
+}
+
+static unsigned applied_count;
+
+static void count_applied(int8_t id) {
+    applied_count++;
+}
+
+class TransactionBatch : public ::testing::Test {
+   protected:
+    uint8_t       frame[frame_size];
+    split_batch_t batch;
+    uint8_t       seq;
+    uint8_t       last_seq;
+    uint32_t      synced;
+
+    void SetUp() override {
+        memset(initiator, 0, sizeof(initiator));
+        memset(target, 0, sizeof(target));
+        split_batch_init(&batch, frame, sizeof(frame));
+        seq           = 0;
+        last_seq      = 0;
+        // The target has been running alongside the initiator, and has every region it sent
+        synced        = UINT32_MAX;
+        applied_count = 0;
+    }
+
+    bool put(int8_t id, const void *data, bool raw = false) {
+        return split_batch_encode(&batch, id, initiator[id], data, region_size[id], raw);
+    }
+
+    // Transfers the batch, returning the number of bytes it occupied
+    uint8_t transfer() {
+        uint8_t used = split_batch_finish(&batch, ++seq);
+        EXPECT_TRUE(split_batch_decode(frame, sizeof(frame), &last_seq, &synced, target_region, count_applied));
+        split_batch_init(&batch, frame, sizeof(frame));
+        return used;
+    }
+
+    void expect_in_sync() {
+        for (int id = 0; id < NUM_REGIONS; id++) {
+            EXPECT_EQ(memcmp(initiator[id], target[id], region_size[id]), 0) << "region " << id;
+        }
+    }
+};
+
+TEST_F(TransactionBatch, UnchangedBytesAreSkipped) {
+    uint8_t rgb[9] = {0};
+
+    rgb[1] = 0x40;
+    ASSERT_TRUE(put(RGB_MATRIX, rgb));
+    // Record header, a skip token, a literal token with its byte, then a skip token for the rest
+    EXPECT_EQ(batch.used, SPLIT_BATCH_HEADER_SIZE + SPLIT_BATCH_RECORD_HEADER_SIZE + 4);
+    EXPECT_EQ(frame[SPLIT_BATCH_HEADER_SIZE] & SPLIT_BATCH_RAW, 0);
+    transfer();
+    expect_in_sync();
+}
+
+TEST_F(TransactionBatch, ScatteredChangesAreSentRaw) {
+    uint8_t activity[12];
+
+    for (uint8_t i = 0; i < sizeof(activity); i++) {
+        activity[i] = (i & 1) ? 0x55 : 0;
+    }
+    ASSERT_TRUE(put(ACTIVITY, activity));
+    EXPECT_EQ(batch.used, SPLIT_BATCH_HEADER_SIZE + SPLIT_BATCH_RECORD_HEADER_SIZE + sizeof(activity));
+    EXPECT_EQ(frame[SPLIT_BATCH_HEADER_SIZE] & SPLIT_BATCH_RAW, SPLIT_BATCH_RAW);
+    transfer();
+    expect_in_sync();
+}
+
+TEST_F(TransactionBatch, RetriedFrameIsAppliedOnce) {
+    uint32_t layer_state = 0x0005;
+
+    ASSERT_TRUE(put(LAYER_STATE, &layer_state));
+    uint8_t used = split_batch_finish(&batch, ++seq);
+    ASSERT_GT(used, SPLIT_BATCH_HEADER_SIZE);
+
+    EXPECT_TRUE(split_batch_decode(frame, sizeof(frame), &last_seq, &synced, target_region, count_applied));
+    EXPECT_TRUE(split_batch_decode(frame, sizeof(frame), &last_seq, &synced, target_region, count_applied));
+    EXPECT_EQ(applied_count, 1);
+    EXPECT_EQ(last_seq, seq);
+    expect_in_sync();
+}
+
+TEST_F(TransactionBatch, RestartFrameIsAppliedAfterInitiatorReset) {
+    uint32_t layer_state = 0x0005;
+
+    // The target still holds the sequence number of the initiator's first frame before it was reset
+    last_seq               = SPLIT_BATCH_SEQ_RESTART + 1;
+    target[LAYER_STATE][0] = 0x07;
+
+    ASSERT_TRUE(put(LAYER_STATE, &layer_state, true));
+    split_batch_finish(&batch, SPLIT_BATCH_SEQ_RESTART);
+    EXPECT_TRUE(split_batch_decode(frame, sizeof(frame), &last_seq, &synced, target_region, count_applied));
+    EXPECT_TRUE(split_batch_decode(frame, sizeof(frame), &last_seq, &synced, target_region, count_applied));
+    EXPECT_EQ(applied_count, 2);
+    EXPECT_EQ(last_seq, SPLIT_BATCH_SEQ_RESTART);
+    expect_in_sync();
+    split_batch_init(&batch, frame, sizeof(frame));
+
+    // The initiator carries on counting from the restart once a frame is acknowledged
+    layer_state = 0x0009;
+    ASSERT_TRUE(put(LAYER_STATE, &layer_state));
+    transfer();
+    EXPECT_EQ(applied_count, 3);
+    expect_in_sync();
+}
+
+TEST_F(TransactionBatch, DeltasAreRejectedAfterTargetReset) {
+    uint32_t layer_state = 0x0005;
+    uint8_t  mods[4]     = {0x02, 0, 0, 0};
+
+    ASSERT_TRUE(put(LAYER_STATE, &layer_state));
+    ASSERT_TRUE(put(MODS, mods));
+    transfer();
+    expect_in_sync();
+
+    // The target starts again with zeroed memory, while the initiator carries on from where it was
+    memset(target, 0, sizeof(target));
+    last_seq = SPLIT_BATCH_SEQ_RESTART;
+    synced   = 0;
+
+    layer_state = 0x0009;
+    ASSERT_TRUE(put(LAYER_STATE, &layer_state));
+    split_batch_finish(&batch, ++seq);
+    EXPECT_FALSE(split_batch_decode(frame, sizeof(frame), &last_seq, &synced, target_region, count_applied));
+    EXPECT_EQ(applied_count, 2);
+    EXPECT_EQ(target[LAYER_STATE][0], 0);
+    split_batch_init(&batch, frame, sizeof(frame));
+
+    // Once a region got through raw, deltas against it are applied again
+    ASSERT_TRUE(put(LAYER_STATE, &layer_state, true));
+    transfer();
+    EXPECT_EQ(memcmp(initiator[LAYER_STATE], target[LAYER_STATE], region_size[LAYER_STATE]), 0);
+
+    layer_state = 0x000D;
+    ASSERT_TRUE(put(LAYER_STATE, &layer_state));
+    EXPECT_EQ(frame[SPLIT_BATCH_HEADER_SIZE] & SPLIT_BATCH_RAW, 0);
+    transfer();
+
+    // A region that only ever got deltas since the reset is still refused
+    mods[0] = 0x06;
+    ASSERT_TRUE(put(MODS, mods));
+    split_batch_finish(&batch, ++seq);
+    EXPECT_FALSE(split_batch_decode(frame, sizeof(frame), &last_seq, &synced, target_region, count_applied));
+    split_batch_init(&batch, frame, sizeof(frame));
+
+    ASSERT_TRUE(put(MODS, mods, true));
+    transfer();
+    expect_in_sync();
+}
+
+TEST_F(TransactionBatch, CorruptFrameIsRejected) {
+    uint32_t layer_state = 0x0005;
+    uint8_t  mods[4]     = {0x02, 0, 0, 0};
+
+    ASSERT_TRUE(put(LAYER_STATE, &layer_state));
+    ASSERT_TRUE(put(MODS, mods));
+    split_batch_finish(&batch, ++seq);
+    frame[frame[1] + SPLIT_BATCH_HEADER_SIZE - 1] ^= 0x01;
+
+    EXPECT_FALSE(split_batch_decode(frame, sizeof(frame), &last_seq, &synced, target_region, count_applied));
+    EXPECT_EQ(applied_count, 0);
+    EXPECT_EQ(last_seq, 0);
+    EXPECT_EQ(target[LAYER_STATE][0], 0);
+}
+
+TEST_F(TransactionBatch, UnknownRegionRejectsWholeFrame) {
+    uint32_t layer_state = 0x0005;
+
+    ASSERT_TRUE(put(LAYER_STATE, &layer_state));
+    ASSERT_TRUE(split_batch_encode(&batch, NUM_REGIONS, initiator[LARGE], &layer_state, sizeof(layer_state), true));
+    split_batch_finish(&batch, ++seq);
+
+    EXPECT_FALSE(split_batch_decode(frame, sizeof(frame), &last_seq, &synced, target_region, count_applied));
+    EXPECT_EQ(applied_count, 0);
+    EXPECT_EQ(target[LAYER_STATE][0], 0);
+}
+
+TEST_F(TransactionBatch, RawRecordRecoversDivergedTarget) {
+    uint32_t layer_state = 0x0005;
+
+    memset(target[LAYER_STATE], 0xAA, region_size[LAYER_STATE]);
+    ASSERT_TRUE(put(LAYER_STATE, &layer_state, true));
+    transfer();
+    expect_in_sync();
+}
+
+TEST_F(TransactionBatch, FullFrameLeavesShadowUntouched) {
+    uint8_t large[56];
+    uint8_t rgb[9];
+
+    memset(large, 0x11, sizeof(large));
+    memset(rgb, 0x22, sizeof(rgb));
+    ASSERT_TRUE(put(LARGE, large));
+    EXPECT_FALSE(put(RGB_MATRIX, rgb));
+    EXPECT_EQ(initiator[RGB_MATRIX][0], 0);
+
+    transfer();
+    ASSERT_TRUE(put(RGB_MATRIX, rgb));
+    transfer();
+    expect_in_sync();
+}
+
+TEST_F(TransactionBatch, LoopbackBenchmark) {
+    /* Replays a typing session at one sync per scan, with the forced resend every 100 syncs, and
+     * compares against sending each changed region as a transaction of its own. */
+    const unsigned syncs = 10000;
+
+    unsigned single_round_trips = 0, single_bytes = 0;
+    unsigned batch_round_trips = 0, batch_bytes = 0;
+
+    uint8_t  matrix[4] = {0}, mods[4] = {0}, rgb[9] = {0}, activity[12] = {0};
+    uint32_t sync_timer = 0, layer_state = 0, default_layer_state = 1;
+    uint8_t  led_state = 0, wpm = 0, oled = 1;
+
+    for (unsigned i = 0; i < syncs; i++) {
+        bool forced = (i % 100) == 0;
+
+        if (i % 3 == 0) {
+            matrix[(i / 3) % 4] ^= 1 << ((i / 12) % 8);
+            memcpy(activity, &i, sizeof(i));
+        }
+        if (i % 7 == 0) mods[0] ^= 0x02;
+        if (i % 20 == 0) wpm = (i / 20) % 120;
+        if (i % 50 == 0) layer_state ^= 0x2;
+        if (i % 250 == 0) rgb[1]++;
+        if (i % 1000 == 0) led_state ^= 0x2;
+        sync_timer = i;
+
+        struct {
+            int8_t      id;
+            const void *data;
+            bool        send;
+        } updates[] = {
+            {MASTER_MATRIX, matrix, false}, {SYNC_TIMER, &sync_timer, forced}, {LAYER_STATE, &layer_state, false}, {DEFAULT_LAYER_STATE, &default_layer_state, false}, {LED_STATE, &led_state, false}, {MODS, mods, false}, {RGB_MATRIX, rgb, false}, {WPM, &wpm, false}, {OLED, &oled, false}, {ACTIVITY, activity, false},
+        };
+
+        for (auto &update : updates) {
+            bool changed = memcmp(initiator[update.id], update.data, region_size[update.id]) != 0;
+            if (!(forced || changed || update.send)) continue;
+
+            // One transaction per region: the ID and its echo, then the region
+            single_round_trips++;
+            single_bytes += 2 + region_size[update.id];
+
+            if (!put(update.id, update.data, forced)) {
+                // Frame is full, send it and start another, as transport_put() does
+                batch_round_trips++;
+                batch_bytes += 2 + transfer() + 1;
+                ASSERT_TRUE(put(update.id, update.data, forced));
+            }
+        }
+
+        if (!split_batch_is_empty(&batch)) {
+            // The ID and its echo, the frame, then the acknowledgement
+            batch_round_trips++;
+            batch_bytes += 2 + transfer() + 1;
+        }
+        expect_in_sync();
+    }
+
+    EXPECT_LT(batch_round_trips, single_round_trips);
+    EXPECT_LT(batch_bytes, single_bytes);
+
+    printf("[ BENCH    ] %-10s %6.3f round trips/sync %7.2f bytes/sync %8.0f bytes/s at 1kHz\n", "separate", (double)single_round_trips / syncs, (double)single_bytes / syncs, (double)single_bytes / syncs * 1000);
+    printf("[ BENCH    ] %-10s %6.3f round trips/sync %7.2f bytes/sync %8.0f bytes/s at 1kHz\n", "batched", (double)batch_round_trips / syncs, (double)batch_bytes / syncs, (double)batch_bytes / syncs * 1000);
+}
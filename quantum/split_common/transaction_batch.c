@@ -0,0 +1,174 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "crc.h"
+#include "transaction_batch.h"
+
+#define SPLIT_BATCH_RUN_MAX 128
+#define SPLIT_BATCH_SKIP 0x80
+
+void split_batch_init(split_batch_t *batch, uint8_t *frame, uint8_t size) {
+    batch->frame = frame;
+    batch->size  = size;
+    batch->used  = SPLIT_BATCH_HEADER_SIZE;
+}
+
+// Writes the XOR delta of data against shadow to out, returning its length, or 0 if it needs more than limit bytes
+static uint8_t encode_delta(uint8_t *out, uint8_t limit, const uint8_t *shadow, const uint8_t *data, uint8_t length) {
+    uint8_t used = 0;
+    uint8_t pos  = 0;
+
+    while (pos < length) {
+        uint8_t run = 0;
+        if (shadow[pos] == data[pos]) {
+            while (pos + run < length && run < SPLIT_BATCH_RUN_MAX && shadow[pos + run] == data[pos + run]) {
+                run++;
+            }
+            if (used + 1 > limit) return 0;
+            out[used++] = SPLIT_BATCH_SKIP | (run - 1);
+        } else {
+            while (pos + run < length && run < SPLIT_BATCH_RUN_MAX && shadow[pos + run] != data[pos + run]) {
+                run++;
+            }
+            if (used + 1 + run > limit) return 0;
+            out[used++] = run - 1;
+            for (uint8_t i = 0; i < run; i++) {
+                out[used++] = shadow[pos + i] ^ data[pos + i];
+            }
+        }
+        pos += run;
+    }
+
+    return used;
+}
+
+bool split_batch_encode(split_batch_t *batch, int8_t id, uint8_t *shadow, const void *data, uint8_t length, bool raw) {
+    if (batch->used + SPLIT_BATCH_RECORD_HEADER_SIZE > batch->size) {
+        return false;
+    }
+
+    uint8_t *record    = &batch->frame[batch->used];
+    uint8_t  available = batch->size - batch->used - SPLIT_BATCH_RECORD_HEADER_SIZE;
+    uint8_t  payload   = 0;
+
+    if (!raw) {
+        // Only worth it if the delta is smaller than the region itself
+        uint8_t limit = available < length - 1 ? available : length - 1;
+        payload       = encode_delta(&record[SPLIT_BATCH_RECORD_HEADER_SIZE], limit, shadow, data, length);
+        raw           = payload == 0;
+    }
+
+    if (raw) {
+        if (length > available) {
+            return false;
+        }
+        memcpy(&record[SPLIT_BATCH_RECORD_HEADER_SIZE], data, length);
+        payload = length;
+    }
+
+    record[0] = (uint8_t)id | (raw ? SPLIT_BATCH_RAW : 0);
+    batch->used += SPLIT_BATCH_RECORD_HEADER_SIZE + payload;
+    if (shadow != data) {
+        memcpy(shadow, data, length);
+    }
+    return true;
+}
+
+uint8_t split_batch_finish(split_batch_t *batch, uint8_t seq) {
+    uint8_t length = batch->used - SPLIT_BATCH_HEADER_SIZE;
+
+    batch->frame[0] = seq;
+    batch->frame[1] = length;
+    batch->frame[2] = crc8(&batch->frame[SPLIT_BATCH_HEADER_SIZE], length);
+    return batch->used;
+}
+
+// Returns the number of payload bytes the delta took up, or 0 if it runs past either buffer
+static uint8_t decode_delta(uint8_t *region, uint8_t length, const uint8_t *payload, uint8_t payload_length, bool apply) {
+    uint8_t pos = 0;
+    uint8_t in  = 0;
+
+    while (pos < length) {
+        if (in >= payload_length) return 0;
+
+        uint8_t token = payload[in++];
+        uint8_t run   = (token & ~SPLIT_BATCH_SKIP) + 1;
+        if (pos + run > length) return 0;
+
+        if (token & SPLIT_BATCH_SKIP) {
+            pos += run;
+            continue;
+        }
+
+        if (in + run > payload_length) return 0;
+        for (uint8_t i = 0; i < run; i++, pos++, in++) {
+            if (apply) {
+                region[pos] ^= payload[in];
+            }
+        }
+    }
+
+    return in;
+}
+
+static bool decode_records(const uint8_t *records, uint8_t length, uint32_t *synced, split_batch_region_t region, split_batch_applied_t applied, bool apply) {
+    uint8_t pos = 0;
+
+    while (pos < length) {
+        int8_t  id  = records[pos] & ~SPLIT_BATCH_RAW;
+        bool    raw = records[pos] & SPLIT_BATCH_RAW;
+        uint8_t payload_length;
+
+        pos += SPLIT_BATCH_RECORD_HEADER_SIZE;
+
+        if (id >= SPLIT_BATCH_MAX_ID) return false;
+        // A delta needs what the initiator last sent, which a target that started since then doesn't have
+        if (!raw && !(*synced & (1UL << id))) return false;
+        *synced |= 1UL << id;
+
+        uint8_t  region_length = 0;
+        uint8_t *target        = region(id, &region_length);
+        if (!target) return false;
+
+        if (raw) {
+            if (region_length > length - pos) return false;
+            if (apply) {
+                memcpy(target, &records[pos], region_length);
+            }
+            payload_length = region_length;
+        } else {
+            payload_length = decode_delta(target, region_length, &records[pos], length - pos, apply);
+            if (payload_length == 0) return false;
+        }
+        pos += payload_length;
+
+        if (apply && applied) {
+            applied(id);
+        }
+    }
+
+    return true;
+}
+
+bool split_batch_decode(const uint8_t *frame, uint8_t size, uint8_t *last_seq, uint32_t *synced, split_batch_region_t region, split_batch_applied_t applied) {
+    if (size < SPLIT_BATCH_HEADER_SIZE) return false;
+
+    uint8_t length = frame[1];
+    if (length > size - SPLIT_BATCH_HEADER_SIZE) return false;
+
+    const uint8_t *records = &frame[SPLIT_BATCH_HEADER_SIZE];
+    if (frame[2] != crc8(records, length)) return false;
+
+    // A retried frame the target already applied; applying the deltas twice would undo them
+    if (frame[0] == *last_seq && frame[0] != SPLIT_BATCH_SEQ_RESTART) return true;
+
+    // Check the whole frame before touching any region, so a bad frame can be retried safely
+    uint32_t checked = *synced;
+    if (!decode_records(records, length, &checked, region, NULL, false)) return false;
+    decode_records(records, length, synced, region, applied, true);
+
+    *last_seq = frame[0];
+    return true;
+}
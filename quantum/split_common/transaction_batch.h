@@ -0,0 +1,68 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* A batch frame carries the updates of several initiator-to-target transactions in one transfer.
+ *
+ * Frame layout:
+ *   [seq] [records length] [crc8 of records] [records...]
+ *
+ * Each record is [id | SPLIT_BATCH_RAW] [payload...]. A raw payload is the whole region, otherwise
+ * the payload is the region XORed with what was last sent for it, encoded as tokens that together
+ * cover the region:
+ *   0x00-0x7F: (token + 1) literal XOR bytes follow
+ *   0x80-0xFF: (token & 0x7F) + 1 bytes are unchanged
+ * Either way the target knows the region's length, so records carry no length of their own.
+ */
+
+#define SPLIT_BATCH_HEADER_SIZE 3
+#define SPLIT_BATCH_RECORD_HEADER_SIZE 1
+#define SPLIT_BATCH_RAW 0x80
+// Records can only be sent for the transactions below this id, so the target can keep track of them in a bitmap
+#define SPLIT_BATCH_MAX_ID 32
+// Sequence number an initiator uses after starting up, until a frame is acknowledged. These frames only carry raw
+// records, so the target applies each of them even when it last applied the same number.
+#define SPLIT_BATCH_SEQ_RESTART 0
+
+typedef struct split_batch_t {
+    uint8_t *frame;
+    uint8_t  size;
+    uint8_t  used;
+} split_batch_t;
+
+// Returns the target buffer of a transaction, and its length, or NULL if it can't be part of a batch
+typedef uint8_t *(*split_batch_region_t)(int8_t id, uint8_t *length);
+// Called once a record has been applied to its region
+typedef void (*split_batch_applied_t)(int8_t id);
+
+void split_batch_init(split_batch_t *batch, uint8_t *frame, uint8_t size);
+
+static inline bool split_batch_is_empty(const split_batch_t *batch) {
+    return batch->used == SPLIT_BATCH_HEADER_SIZE;
+}
+
+/**
+ * @brief Appends the update of one region to the batch.
+ *
+ * `shadow` holds what the target last received for the region; it is updated to `data` when the
+ * record fits. Nothing is changed when it doesn't.
+ */
+bool split_batch_encode(split_batch_t *batch, int8_t id, uint8_t *shadow, const void *data, uint8_t length, bool raw);
+
+// Fills in the frame header, returning the number of bytes to transfer
+uint8_t split_batch_finish(split_batch_t *batch, uint8_t seq);
+
+/**
+ * @brief Applies a received frame.
+ *
+ * A frame carrying `*last_seq` has already been applied, and is acknowledged without applying it
+ * again, unless it is SPLIT_BATCH_SEQ_RESTART. `synced` has a bit set for each region that got a
+ * raw record since the target started, and starts out as 0; frames with a delta for any other
+ * region are rejected, so the initiator sends them raw instead. Returns false if the frame is
+ * corrupt or rejected.
+ */
+bool split_batch_decode(const uint8_t *frame, uint8_t size, uint8_t *last_seq, uint32_t *synced, split_batch_region_t region, split_batch_applied_t applied);
@@ -118,6 +118,10 @@ enum serial_transaction_id {
     PUT_DETECTED_OS,
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+#ifdef SPLIT_TRANSACTION_BATCHING
+    PUT_BATCH,
+#endif // SPLIT_TRANSACTION_BATCHING
+
     NUM_TOTAL_TRANSACTIONS
 };
 
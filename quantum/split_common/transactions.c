@@ -20,6 +20,7 @@
 
 #include "crc.h"
 #include "debug.h"
+#include "util.h"
 #include "matrix.h"
 #include "host.h"
 #include "action_util.h"
@@ -64,6 +65,9 @@
 #ifdef WPM_ENABLE
 #    include "wpm.h"
 #endif
+#ifdef SPLIT_TRANSACTION_BATCHING
+#    include "transaction_batch.h"
+#endif
 
 #define SYNC_TIMER_OFFSET 2
 
@@ -144,10 +148,181 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         split_shared_memory_unlock();                         \
     } while (0)
 
+#ifdef SPLIT_TRANSACTION_BATCHING
+
+_Static_assert(SPLIT_TRANSACTION_BATCH_SIZE <= 255, "SPLIT_TRANSACTION_BATCH_SIZE must fit in a transaction");
+_Static_assert(SPLIT_BATCH_SEQ_RESTART == 0, "The target starts out with a zeroed sequence number in shared memory");
+
+static uint8_t       batch_frame[SPLIT_TRANSACTION_BATCH_SIZE];
+static split_batch_t batch     = {batch_frame, sizeof(batch_frame), SPLIT_BATCH_HEADER_SIZE};
+static uint8_t       batch_seq = SPLIT_BATCH_SEQ_RESTART;
+// Whether a frame got through since starting up, the target may still hold a sequence number from before
+static bool batch_acked = false;
+// Transactions in the frame being built
+static uint32_t batch_ids = 0;
+// Transactions the target may have missed an update for; these are sent raw until they get through
+static uint32_t batch_raw_pending = UINT32_MAX;
+
+// Whether the target answered the last frame with a NAK, having received it
+static bool batch_rejected = false;
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    uint8_t ack = 0;
+    if (!transport_execute_transaction(PUT_BATCH, batch_frame, batch.used, &ack, sizeof(ack))) {
+        return false;
+    }
+    // Sending the same frame again would only get the same answer
+    batch_rejected = ack == (uint8_t)~batch_seq;
+    return batch_rejected || ack == batch_seq;
+}
+
+static bool batch_put(int8_t id, const void *data, uint8_t length, bool forced);
+
+// Sends the current contents of the given transactions as raw records
+static bool batch_resend_raw(uint32_t ids) {
+    for (int8_t id = 0; id < SPLIT_BATCH_MAX_ID; id++) {
+        if (ids & (1UL << id)) {
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            if (!batch_put(id, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size, true)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool batch_flush(void) {
+    static bool resending = false;
+
+    if (split_batch_is_empty(&batch)) {
+        return true;
+    }
+
+    // Retries resend the same sequence number, which the target only applies once
+    if (batch_acked && ++batch_seq == SPLIT_BATCH_SEQ_RESTART) {
+        batch_seq = SPLIT_BATCH_SEQ_RESTART + 1;
+    }
+    split_batch_finish(&batch, batch_seq);
+
+    batch_rejected = false;
+    bool     okay  = transaction_handler_master(NULL, NULL, "batch", &batch_handlers_master) && !batch_rejected;
+    uint32_t ids   = batch_ids;
+    if (okay) {
+        batch_acked = true;
+        batch_raw_pending &= ~ids;
+    } else {
+        batch_raw_pending |= ids;
+    }
+
+    batch_ids = 0;
+    split_batch_init(&batch, batch_frame, sizeof(batch_frame));
+
+    if (batch_rejected && !resending) {
+        // The target doesn't have what the deltas were made against, most likely because it restarted
+        resending = true;
+        okay      = batch_resend_raw(ids) && batch_flush();
+        resending = false;
+    }
+    return okay;
+}
+
+/**
+ * @brief Queues an initiator-to-target update for the batch sent at the end of transactions_master().
+ *
+ * Updates are encoded as a delta against what was last sent, except for forced syncs, which are
+ * sent raw so the target recovers from anything it missed.
+ */
+static bool batch_put(int8_t id, const void *data, uint8_t length, bool forced) {
+    if (id >= SPLIT_BATCH_MAX_ID) {
+        return transport_write(id, data, length);
+    }
+
+    uint8_t *shadow = split_trans_initiator2target_buffer(&split_transaction_table[id]);
+    bool     raw    = forced || (batch_raw_pending & (1UL << id)) || data == shadow;
+
+    if (!split_batch_encode(&batch, id, shadow, data, length, raw)) {
+        if (!batch_flush()) {
+            return false;
+        }
+        if (!split_batch_encode(&batch, id, shadow, data, length, raw)) {
+            // Too large to share a frame with anything, so send it on its own. The target only accepts deltas
+            // against raw records it got in a batch, so later updates have to go the same way.
+            batch_raw_pending |= 1UL << id;
+            return transport_write(id, data, length);
+        }
+    }
+
+    batch_ids |= 1UL << id;
+    return true;
+}
+
+static uint8_t *batch_region(int8_t id, uint8_t *length) {
+    if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS || id == PUT_BATCH) {
+        return NULL;
+    }
+
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (trans->initiator2target_buffer_size == 0) {
+        return NULL;
+    }
+
+    *length = trans->initiator2target_buffer_size;
+    return split_trans_initiator2target_buffer(trans);
+}
+
+static void batch_applied(int8_t id) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+}
+
+static void batch_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    uint8_t seq = *(const uint8_t *)initiator2target_buffer;
+
+    // Kept in the target's shared memory, which starts out zeroed, like the target's view of every region
+    bool okay = split_batch_decode(initiator2target_buffer, initiator2target_buffer_size, &split_shmem->batch_last_seq, &split_shmem->batch_synced, batch_region, batch_applied);
+    // Acknowledge with anything but the frame's sequence number when it didn't decode, so the initiator retries it
+    *(uint8_t *)target2initiator_buffer = okay ? seq : ~seq;
+}
+
+#    define TRANSACTIONS_BATCH_MASTER()       \
+        do {                                  \
+            if (!batch_flush()) return false; \
+        } while (0)
+#    define TRANSACTIONS_BATCH_REGISTRATIONS \
+        [PUT_BATCH] = {sizeof_member(split_shared_memory_t, batch_frame), offsetof(split_shared_memory_t, batch_frame), sizeof_member(split_shared_memory_t, batch_ack), offsetof(split_shared_memory_t, batch_ack), batch_slave_callback},
+
+#else // SPLIT_TRANSACTION_BATCHING
+
+#    define TRANSACTIONS_BATCH_MASTER()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSACTION_BATCHING
+
+#ifdef SPLIT_SYNC_SCHEDULER
+// Updates exchanged with the slave during the current sync, which the scheduler budgets cosmetic data against
+static uint8_t sync_updates = 0;
+#endif // SPLIT_SYNC_SCHEDULER
+
+static bool transport_put(int8_t id, const void *data, uint8_t length, bool forced) {
+#ifdef SPLIT_SYNC_SCHEDULER
+    sync_updates++;
+#endif // SPLIT_SYNC_SCHEDULER
+#ifdef SPLIT_TRANSACTION_BATCHING
+    return batch_put(id, data, length, forced);
+#else
+    return transport_write(id, data, length);
+#endif // SPLIT_TRANSACTION_BATCHING
+}
+
 inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
     uint8_t curr_checksum;
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
     if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length))) {
+#ifdef SPLIT_SYNC_SCHEDULER
+        sync_updates++;
+#endif // SPLIT_SYNC_SCHEDULER
         okay &= transport_read(trans_id_retrieve, destination, length);
         okay &= curr_checksum == crc8(equiv_shmem, length);
         if (okay) {
@@ -161,8 +336,9 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
 
 inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
     bool okay = true;
-    if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
-        okay &= transport_write(trans_id, source, length);
+    bool forced = timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS;
+    if (forced || condition) {
+        okay &= transport_put(trans_id, source, length, forced);
         if (okay) {
             *last_update = timer_read32();
         }
@@ -302,7 +478,7 @@ static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_
     bool okay = true;
     if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
         uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
-        okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
+        okay &= transport_put(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer), true);
         if (okay) {
             last_update = timer_read32();
         }
@@ -427,7 +603,7 @@ static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slav
 
     bool okay = true;
     if (mods_need_sync) {
-        okay &= transport_write(PUT_MODS, &new_mods, sizeof(new_mods));
+        okay &= transport_put(PUT_MODS, &new_mods, sizeof(new_mods), timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS);
         if (okay) {
             last_update = timer_read32();
         }
@@ -793,7 +969,7 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 static bool watchdog_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     bool okay = true;
     if (!split_watchdog_check()) {
-        okay = transport_write(PUT_WATCHDOG, &okay, sizeof(okay));
+        okay = transport_put(PUT_WATCHDOG, &okay, sizeof(okay), true);
         split_watchdog_update(okay);
     }
     return okay;
@@ -944,6 +1120,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_BATCH_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -954,6 +1131,99 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 };
 
+#ifdef SPLIT_SYNC_SCHEDULER
+
+static split_sync_stats_t sync_stats[SPLIT_SYNC_CLASS_COUNT];
+static uint32_t           sync_stats_since = 0;
+
+// Cosmetic data, in the order the scheduler visits it
+// clang-format off
+#define SPLIT_SYNC_COSMETIC_HANDLERS(X) \
+    X(LAYER_STATE) X(LED_STATE) X(MODS) X(BACKLIGHT) X(RGBLIGHT) X(LED_MATRIX) X(RGB_MATRIX) \
+    X(WPM) X(OLED) X(ST7565) X(HAPTIC) X(ACTIVITY) X(DETECTED_OS)
+// clang-format on
+
+#define COSMETIC_HANDLER_MASTER(name)                                                                  \
+    static bool cosmetic_##name##_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) { \
+        TRANSACTIONS_##name##_MASTER();                                                               \
+        return true;                                                                                  \
+    }
+SPLIT_SYNC_COSMETIC_HANDLERS(COSMETIC_HANDLER_MASTER)
+
+#define COSMETIC_HANDLER_ENTRY(name) cosmetic_##name##_master,
+static bool (*const cosmetic_handlers[])(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) = {SPLIT_SYNC_COSMETIC_HANDLERS(COSMETIC_HANDLER_ENTRY)};
+
+#define NUM_COSMETIC_HANDLERS ARRAY_SIZE(cosmetic_handlers)
+
+/**
+ * @brief Services cosmetic data with whatever is left of the sync's update budget.
+ *
+ * Handlers are visited round-robin, carrying on from where the previous sync stopped. Should a full
+ * round take longer than SPLIT_SYNC_COSMETIC_DEADLINE_MS, every handler runs once regardless of budget.
+ */
+static bool cosmetic_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint8_t  next_handler = 0;
+    static uint32_t round_start  = 0;
+
+    bool overdue = timer_elapsed32(round_start) >= SPLIT_SYNC_COSMETIC_DEADLINE_MS;
+
+    for (uint8_t visited = 0; visited < NUM_COSMETIC_HANDLERS; visited++) {
+        if (!overdue && sync_updates >= SPLIT_SYNC_UPDATE_BUDGET) {
+            sync_stats[SPLIT_SYNC_CLASS_COSMETIC].deferred++;
+            break;
+        }
+
+        uint8_t handler = next_handler;
+        if (++next_handler == NUM_COSMETIC_HANDLERS) {
+            next_handler = 0;
+            round_start  = timer_read32();
+        }
+        if (!cosmetic_handlers[handler](master_matrix, slave_matrix)) return false;
+    }
+    return true;
+}
+
+bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    sync_updates = 0;
+
+    // Key and pointer data, serviced on every sync
+    TRANSACTIONS_SLAVE_MATRIX_MASTER();
+    TRANSACTIONS_MASTER_MATRIX_MASTER();
+    TRANSACTIONS_ENCODERS_MASTER();
+    TRANSACTIONS_POINTING_MASTER();
+    TRANSACTIONS_SYNC_TIMER_MASTER();
+    TRANSACTIONS_WATCHDOG_MASTER();
+
+    uint8_t realtime_updates = sync_updates;
+    sync_stats[SPLIT_SYNC_CLASS_REALTIME].updates += realtime_updates;
+
+    if (!cosmetic_handlers_master(master_matrix, slave_matrix)) return false;
+    sync_stats[SPLIT_SYNC_CLASS_COSMETIC].updates += sync_updates - realtime_updates;
+
+    TRANSACTIONS_BATCH_MASTER();
+    return true;
+}
+
+const split_sync_stats_t *transactions_sync_stats(split_sync_class_t sync_class) {
+    return &sync_stats[sync_class];
+}
+
+uint16_t transactions_sync_rate(split_sync_class_t sync_class) {
+    uint32_t elapsed = timer_elapsed32(sync_stats_since);
+    if (!elapsed) {
+        return 0;
+    }
+    uint64_t rate = (uint64_t)sync_stats[sync_class].updates * 1000 / elapsed;
+    return rate > UINT16_MAX ? UINT16_MAX : rate;
+}
+
+void transactions_sync_stats_reset(void) {
+    memset(sync_stats, 0, sizeof(sync_stats));
+    sync_stats_since = timer_read32();
+}
+
+#else // SPLIT_SYNC_SCHEDULER
+
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
@@ -974,9 +1244,12 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_BATCH_MASTER();
     return true;
 }
 
+#endif // SPLIT_SYNC_SCHEDULER
+
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     TRANSACTIONS_SLAVE_MATRIX_SLAVE();
     TRANSACTIONS_MASTER_MATRIX_SLAVE();
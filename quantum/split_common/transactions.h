@@ -45,6 +45,32 @@ extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
+#ifdef SPLIT_SYNC_SCHEDULER
+#    ifndef SPLIT_SYNC_UPDATE_BUDGET
+#        define SPLIT_SYNC_UPDATE_BUDGET 4
+#    endif // SPLIT_SYNC_UPDATE_BUDGET
+
+#    ifndef SPLIT_SYNC_COSMETIC_DEADLINE_MS
+#        define SPLIT_SYNC_COSMETIC_DEADLINE_MS 50
+#    endif // SPLIT_SYNC_COSMETIC_DEADLINE_MS
+
+typedef enum split_sync_class_t {
+    SPLIT_SYNC_CLASS_REALTIME, // matrix, encoder and pointing data, serviced every sync
+    SPLIT_SYNC_CLASS_COSMETIC, // lighting, displays and other state, serviced from the leftover budget
+    SPLIT_SYNC_CLASS_COUNT,
+} split_sync_class_t;
+
+typedef struct split_sync_stats_t {
+    uint32_t updates;  // updates exchanged with the slave
+    uint32_t deferred; // syncs where cosmetic handlers were put off for lack of budget
+} split_sync_stats_t;
+
+const split_sync_stats_t *transactions_sync_stats(split_sync_class_t sync_class);
+// Updates per second for the class since the stats were last reset, capped at UINT16_MAX
+uint16_t transactions_sync_rate(split_sync_class_t sync_class);
+void     transactions_sync_stats_reset(void);
+#endif // SPLIT_SYNC_SCHEDULER
+
 void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback);
 
 bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
@@ -31,6 +31,10 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+#ifndef SPLIT_TRANSACTION_BATCH_SIZE
+#    define SPLIT_TRANSACTION_BATCH_SIZE 64
+#endif // SPLIT_TRANSACTION_BATCH_SIZE
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
@@ -222,6 +226,13 @@ typedef struct _split_shared_memory_t {
     split_slave_activity_sync_t activity_sync;
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+#ifdef SPLIT_TRANSACTION_BATCHING
+    uint8_t  batch_frame[SPLIT_TRANSACTION_BATCH_SIZE];
+    uint8_t  batch_ack;
+    uint8_t  batch_last_seq; // only used on the target
+    uint32_t batch_synced;   // only used on the target
+#endif // SPLIT_TRANSACTION_BATCHING
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     rpc_sync_info_t rpc_info;
     uint8_t         rpc_m2s_buffer[RPC_M2S_BUFFER_SIZE];
@@ -0,0 +1,242 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "task_profiler.h"
+#include "timer.h"
+#include "debug.h"
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#    include "chibios_config.h"
+#    define TASK_PROFILER_TICK_FREQ REALTIME_COUNTER_CLOCK
+
+uint32_t task_profiler_ticks(void) {
+    return chSysGetRealtimeCounterX();
+}
+
+#elif defined(__AVR__)
+#    include <avr/io.h>
+#    include "atomic_util.h"
+#    include "timer_avr.h"
+#    define TASK_PROFILER_TICK_FREQ TIMER_RAW_FREQ
+
+uint32_t task_profiler_ticks(void) {
+    uint32_t ms;
+    uint8_t  raw;
+    ATOMIC_BLOCK_FORCEON {
+        ms  = timer_count;
+        raw = TIMER_RAW;
+#    if defined(TIFR0) && defined(OCF0A)
+        // The counter wrapped, but the interrupt counting the millisecond hasn't run yet
+        if ((TIFR0 & _BV(OCF0A)) && raw < TIMER_RAW_TOP / 2) {
+            ms++;
+        }
+#    endif
+    }
+    return ms * (TIMER_RAW_TOP + 1) + raw;
+}
+
+#else
+#    define TASK_PROFILER_TICK_FREQ 1000000
+
+uint32_t task_profiler_ticks(void) {
+    return timer_read32() * 1000;
+}
+#endif
+
+static task_profiler_stats_t task_profiler_stats[TASK_PROFILER_COUNT];
+
+static const char *const task_profiler_names[TASK_PROFILER_COUNT] = {
+    [TASK_PROFILER_LOOP]    = "loop",
+    [TASK_PROFILER_MATRIX]  = "matrix",
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_COMMON_TRANSACTIONS)
+    [TASK_PROFILER_SPLIT_SYNC] = "split sync",
+#endif
+    [TASK_PROFILER_QUANTUM] = "quantum",
+#if defined(AUDIO_ENABLE) && !defined(NO_MUSIC_MODE)
+    [TASK_PROFILER_MUSIC] = "music",
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+    [TASK_PROFILER_KEY_OVERRIDE] = "key override",
+#endif
+#ifdef SEQUENCER_ENABLE
+    [TASK_PROFILER_SEQUENCER] = "sequencer",
+#endif
+#ifdef TAP_DANCE_ENABLE
+    [TASK_PROFILER_TAP_DANCE] = "tap dance",
+#endif
+#ifdef COMBO_ENABLE
+    [TASK_PROFILER_COMBO] = "combo",
+#endif
+#ifdef LEADER_ENABLE
+    [TASK_PROFILER_LEADER] = "leader",
+#endif
+#ifdef WPM_ENABLE
+    [TASK_PROFILER_WPM] = "wpm",
+#endif
+#ifdef DIP_SWITCH_ENABLE
+    [TASK_PROFILER_DIP_SWITCH] = "dip switch",
+#endif
+#ifdef AUTO_SHIFT_ENABLE
+    [TASK_PROFILER_AUTO_SHIFT] = "auto shift",
+#endif
+#ifdef CAPS_WORD_ENABLE
+    [TASK_PROFILER_CAPS_WORD] = "caps word",
+#endif
+#ifdef RGBLIGHT_ENABLE
+    [TASK_PROFILER_RGBLIGHT] = "rgblight",
+#endif
+#ifdef LED_MATRIX_ENABLE
+    [TASK_PROFILER_LED_MATRIX] = "led matrix",
+#endif
+#ifdef RGB_MATRIX_ENABLE
+    [TASK_PROFILER_RGB_MATRIX] = "rgb matrix",
+#endif
+#ifdef ENCODER_ENABLE
+    [TASK_PROFILER_ENCODER] = "encoder",
+#endif
+#ifdef POINTING_DEVICE_ENABLE
+    [TASK_PROFILER_POINTING_DEVICE] = "pointing device",
+#endif
+#ifdef OLED_ENABLE
+    [TASK_PROFILER_OLED] = "oled",
+#endif
+#ifdef ST7565_ENABLE
+    [TASK_PROFILER_ST7565] = "st7565",
+#endif
+#ifdef MOUSEKEY_ENABLE
+    [TASK_PROFILER_MOUSEKEY] = "mousekey",
+#endif
+#ifdef HAPTIC_ENABLE
+    [TASK_PROFILER_HAPTIC] = "haptic",
+#endif
+    [TASK_PROFILER_LED] = "led",
+};
+
+static inline uint32_t ticks_to_us(uint32_t ticks) {
+#if TASK_PROFILER_TICK_FREQ >= 1000000
+    return ticks / (TASK_PROFILER_TICK_FREQ / 1000000);
+#else
+    return ticks * (1000000 / TASK_PROFILER_TICK_FREQ);
+#endif
+}
+
+void task_profiler_add_sample(task_profiler_task_t task, uint32_t elapsed_us) {
+    task_profiler_stats_t *stats = &task_profiler_stats[task];
+
+    if (stats->count == 0 || elapsed_us < stats->min_us) {
+        stats->min_us = elapsed_us;
+    }
+    if (elapsed_us > stats->max_us) {
+        stats->max_us = elapsed_us;
+    }
+    stats->count++;
+    stats->total_us += elapsed_us;
+
+    uint8_t bucket = 0;
+    while (bucket < TASK_PROFILER_BUCKETS - 1 && (elapsed_us >> bucket) != 0) {
+        bucket++;
+    }
+    if (stats->histogram[bucket] < UINT16_MAX) {
+        stats->histogram[bucket]++;
+    }
+}
+
+void task_profiler_record(task_profiler_task_t task, uint32_t start_ticks) {
+    task_profiler_add_sample(task, ticks_to_us(task_profiler_ticks() - start_ticks));
+}
+
+const task_profiler_stats_t *task_profiler_get_stats(task_profiler_task_t task) {
+    return &task_profiler_stats[task];
+}
+
+const char *task_profiler_get_name(task_profiler_task_t task) {
+    return task_profiler_names[task];
+}
+
+uint32_t task_profiler_get_avg_us(task_profiler_task_t task) {
+    const task_profiler_stats_t *stats = &task_profiler_stats[task];
+    return stats->count ? stats->total_us / stats->count : 0;
+}
+
+uint32_t task_profiler_get_percentile_us(task_profiler_task_t task, uint8_t percentile) {
+    const task_profiler_stats_t *stats   = &task_profiler_stats[task];
+    uint32_t                     samples = 0;
+
+    // The buckets saturate, so rank against their sum rather than the sample count
+    for (uint8_t bucket = 0; bucket < TASK_PROFILER_BUCKETS; bucket++) {
+        samples += stats->histogram[bucket];
+    }
+
+    uint32_t rank = (samples * percentile + 99) / 100;
+    uint32_t seen = 0;
+    for (uint8_t bucket = 0; bucket < TASK_PROFILER_BUCKETS - 1; bucket++) {
+        seen += stats->histogram[bucket];
+        if (seen >= rank) {
+            uint32_t upper = ((uint32_t)1 << bucket) - 1;
+            return upper < stats->max_us ? upper : stats->max_us;
+        }
+    }
+    return stats->max_us;
+}
+
+void task_profiler_reset(void) {
+    memset(task_profiler_stats, 0, sizeof(task_profiler_stats));
+}
+
+void task_profiler_dump(void) {
+    dprintf("task profile (us): count min avg p99 max\n");
+    for (uint8_t task = 0; task < TASK_PROFILER_COUNT; task++) {
+        const task_profiler_stats_t *stats = &task_profiler_stats[task];
+        if (!stats->count) continue;
+        dprintf("%16s: %6lu %6lu %6lu %6lu %6lu\n", task_profiler_names[task], (unsigned long)stats->count, (unsigned long)stats->min_us, (unsigned long)task_profiler_get_avg_us(task), (unsigned long)task_profiler_get_percentile_us(task, 99), (unsigned long)stats->max_us);
+    }
+}
+
+void task_profiler_task(void) {
+    static uint32_t last_loop  = 0;
+    static bool     loop_known = false;
+
+    if (loop_known) {
+        task_profiler_record(TASK_PROFILER_LOOP, last_loop);
+    }
+
+#if TASK_PROFILER_INTERVAL > 0
+    static uint32_t last_dump = 0;
+    if (timer_elapsed32(last_dump) >= TASK_PROFILER_INTERVAL) {
+        task_profiler_dump();
+        task_profiler_reset();
+        last_dump = timer_read32();
+    }
+#endif
+
+    last_loop  = task_profiler_ticks();
+    loop_known = true;
+}
+
+static uint8_t put_u32(uint8_t *data, uint32_t value) {
+    data[0] = value & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+    data[2] = (value >> 16) & 0xFF;
+    data[3] = (value >> 24) & 0xFF;
+    return 4;
+}
+
+uint8_t task_profiler_raw_hid_report(task_profiler_task_t task, uint8_t *data, uint8_t length) {
+    if (task >= TASK_PROFILER_COUNT || length < 1 + 5 * 4) {
+        return 0;
+    }
+
+    const task_profiler_stats_t *stats = &task_profiler_stats[task];
+    uint8_t                      used  = 0;
+
+    data[used++] = task;
+    used += put_u32(&data[used], stats->count);
+    used += put_u32(&data[used], stats->min_us);
+    used += put_u32(&data[used], task_profiler_get_avg_us(task));
+    used += put_u32(&data[used], task_profiler_get_percentile_us(task, 99));
+    used += put_u32(&data[used], stats->max_us);
+    return used;
+}
@@ -0,0 +1,150 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Times each subtask of keyboard_task() and quantum_task() with the platform's fastest counter,
+    keeping min/avg/max and a histogram of every task. With the console enabled the results are
+    printed every TASK_PROFILER_INTERVAL milliseconds, they can also be fetched over raw HID with
+    task_profiler_raw_hid_report().
+
+    Other code can be timed the same way:
+
+        TASK_PROFILE(TASK_PROFILER_OLED, oled_task());
+        if (TASK_PROFILE_VALUE(TASK_PROFILER_MATRIX, matrix_task())) { ... }
+*/
+
+#ifndef TASK_PROFILER_INTERVAL
+#    define TASK_PROFILER_INTERVAL 5000
+#endif // TASK_PROFILER_INTERVAL
+
+// Histogram bucket n counts the samples taking up to 2^n - 1 microseconds, the last bucket counts everything longer
+#ifndef TASK_PROFILER_BUCKETS
+#    define TASK_PROFILER_BUCKETS 16
+#endif // TASK_PROFILER_BUCKETS
+
+typedef enum task_profiler_task_t {
+    TASK_PROFILER_LOOP, // the whole main loop, from one keyboard_task() to the next
+    TASK_PROFILER_MATRIX,
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_COMMON_TRANSACTIONS)
+    TASK_PROFILER_SPLIT_SYNC, // part of TASK_PROFILER_MATRIX
+#endif
+    TASK_PROFILER_QUANTUM,
+#if defined(AUDIO_ENABLE) && !defined(NO_MUSIC_MODE)
+    TASK_PROFILER_MUSIC,
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+    TASK_PROFILER_KEY_OVERRIDE,
+#endif
+#ifdef SEQUENCER_ENABLE
+    TASK_PROFILER_SEQUENCER,
+#endif
+#ifdef TAP_DANCE_ENABLE
+    TASK_PROFILER_TAP_DANCE,
+#endif
+#ifdef COMBO_ENABLE
+    TASK_PROFILER_COMBO,
+#endif
+#ifdef LEADER_ENABLE
+    TASK_PROFILER_LEADER,
+#endif
+#ifdef WPM_ENABLE
+    TASK_PROFILER_WPM,
+#endif
+#ifdef DIP_SWITCH_ENABLE
+    TASK_PROFILER_DIP_SWITCH,
+#endif
+#ifdef AUTO_SHIFT_ENABLE
+    TASK_PROFILER_AUTO_SHIFT,
+#endif
+#ifdef CAPS_WORD_ENABLE
+    TASK_PROFILER_CAPS_WORD,
+#endif
+#ifdef RGBLIGHT_ENABLE
+    TASK_PROFILER_RGBLIGHT,
+#endif
+#ifdef LED_MATRIX_ENABLE
+    TASK_PROFILER_LED_MATRIX,
+#endif
+#ifdef RGB_MATRIX_ENABLE
+    TASK_PROFILER_RGB_MATRIX,
+#endif
+#ifdef ENCODER_ENABLE
+    TASK_PROFILER_ENCODER,
+#endif
+#ifdef POINTING_DEVICE_ENABLE
+    TASK_PROFILER_POINTING_DEVICE,
+#endif
+#ifdef OLED_ENABLE
+    TASK_PROFILER_OLED,
+#endif
+#ifdef ST7565_ENABLE
+    TASK_PROFILER_ST7565,
+#endif
+#ifdef MOUSEKEY_ENABLE
+    TASK_PROFILER_MOUSEKEY,
+#endif
+#ifdef HAPTIC_ENABLE
+    TASK_PROFILER_HAPTIC,
+#endif
+    TASK_PROFILER_LED,
+    TASK_PROFILER_COUNT,
+} task_profiler_task_t;
+
+typedef struct task_profiler_stats_t {
+    uint32_t count;
+    uint32_t total_us;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint16_t histogram[TASK_PROFILER_BUCKETS];
+} task_profiler_stats_t;
+
+#ifdef TASK_PROFILER_ENABLE
+
+uint32_t task_profiler_ticks(void);
+void     task_profiler_record(task_profiler_task_t task, uint32_t start_ticks);
+void     task_profiler_add_sample(task_profiler_task_t task, uint32_t elapsed_us);
+
+const task_profiler_stats_t *task_profiler_get_stats(task_profiler_task_t task);
+const char                  *task_profiler_get_name(task_profiler_task_t task);
+uint32_t                     task_profiler_get_avg_us(task_profiler_task_t task);
+// Upper bound of the histogram bucket holding the given percentile, capped at the largest sample
+uint32_t task_profiler_get_percentile_us(task_profiler_task_t task, uint8_t percentile);
+void     task_profiler_reset(void);
+// Prints the results over the console
+void     task_profiler_dump(void);
+void     task_profiler_task(void);
+
+/**
+ * @brief Packs a task's results for sending over raw HID.
+ *
+ * Writes the task index, count, min, avg, p99 and max as little-endian 32-bit values after the
+ * task index, returning the number of bytes written or 0 if the task or buffer is out of range.
+ */
+uint8_t task_profiler_raw_hid_report(task_profiler_task_t task, uint8_t *data, uint8_t length);
+
+#    define TASK_PROFILE(task, call)                        \
+        do {                                                \
+            uint32_t profile_start = task_profiler_ticks(); \
+            call;                                           \
+            task_profiler_record(task, profile_start);      \
+        } while (0)
+
+#    define TASK_PROFILE_VALUE(task, expr)                  \
+        ({                                                  \
+            uint32_t profile_start = task_profiler_ticks(); \
+            __typeof__(expr) profile_value = (expr);        \
+            task_profiler_record(task, profile_start);      \
+            profile_value;                                  \
+        })
+
+#else
+
+#    define TASK_PROFILE(task, call) call
+#    define TASK_PROFILE_VALUE(task, expr) (expr)
+
+#endif // TASK_PROFILER_ENABLE
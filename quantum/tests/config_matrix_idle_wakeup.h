@@ -0,0 +1,34 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MATRIX_ROWS 3
+#define MATRIX_COLS 4
+
+#define MATRIX_ROW_PINS {0, 1, 2}
+#define MATRIX_COL_PINS {3, 4, 5, 6}
+#ifndef DIODE_DIRECTION
+#    define DIODE_DIRECTION COL2ROW
+#endif
+
+#define MATRIX_IDLE_WAKEUP
+#define MATRIX_IDLE_WAKEUP_DELAY 50
+
+// The GPIO layer is replaced by a model of the matrix in the test
+typedef uint8_t pin_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void    gpio_set_pin_input_high(pin_t pin);
+void    gpio_set_pin_output(pin_t pin);
+void    gpio_write_pin_low(pin_t pin);
+void    gpio_write_pin_high(pin_t pin);
+uint8_t gpio_read_pin(pin_t pin);
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,195 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "debounce.h"
+#include "timer.h"
+}
+
+/* The GPIO layer is replaced by a model of the switches: an input pin reads low when a pressed key
+ * connects it to a select pin that is driven low. Debouncing is a straight copy, so every change
+ * is seen in the scan that reads it. */
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+#if (DIODE_DIRECTION == COL2ROW)
+#    define SELECT_COUNT MATRIX_ROWS
+#    define SELECT_PINS row_pins
+#else
+#    define SELECT_COUNT MATRIX_COLS
+#    define SELECT_PINS col_pins
+#endif
+
+#define PIN_COUNT (MATRIX_ROWS + MATRIX_COLS)
+
+static bool     output[PIN_COUNT];
+static bool     level[PIN_COUNT];
+static bool     pressed[MATRIX_ROWS][MATRIX_COLS];
+static unsigned pin_reads;
+static unsigned edge_waits;
+
+extern "C" {
+matrix_row_t raw_matrix[MATRIX_ROWS];
+matrix_row_t matrix[MATRIX_ROWS];
+
+void advance_time(uint32_t ms);
+
+void gpio_set_pin_input_high(pin_t pin) {
+    output[pin] = false;
+    level[pin]  = true;
+}
+
+void gpio_set_pin_output(pin_t pin) {
+    output[pin] = true;
+}
+
+void gpio_write_pin_low(pin_t pin) {
+    level[pin] = false;
+}
+
+void gpio_write_pin_high(pin_t pin) {
+    level[pin] = true;
+}
+
+uint8_t gpio_read_pin(pin_t pin) {
+    pin_reads++;
+    if (output[pin]) {
+        return level[pin];
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+#if (DIODE_DIRECTION == COL2ROW)
+            pin_t input = col_pins[col], select = row_pins[row];
+#else
+            pin_t input = row_pins[row], select = col_pins[col];
+#endif
+            if (pressed[row][col] && input == pin && output[select] && !level[select]) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+void matrix_wait_for_edge(void) {
+    edge_waits++;
+}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    if (changed) {
+        memcpy(cooked, raw, num_rows * sizeof(matrix_row_t));
+    }
+    return changed;
+}
+
+void debounce_init(uint8_t num_rows) {}
+void matrix_init_kb(void) {}
+void matrix_scan_kb(void) {}
+void matrix_output_select_delay(void) {}
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {}
+}
+
+class MatrixIdleWakeup : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        memset(pressed, 0, sizeof(pressed));
+        matrix_init();
+        // Leaves the matrix unparked from a previous test, with the idle delay starting now
+        pressed[0][0] = true;
+        matrix_scan();
+        pressed[0][0] = false;
+        matrix_scan();
+    }
+
+    void park() {
+        advance_time(MATRIX_IDLE_WAKEUP_DELAY);
+        matrix_scan();
+        ASSERT_TRUE(parked());
+    }
+
+    bool parked() {
+        for (uint8_t x = 0; x < SELECT_COUNT; x++) {
+            if (!output[SELECT_PINS[x]] || level[SELECT_PINS[x]]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void expect_pins_unselected() {
+        for (uint8_t pin = 0; pin < PIN_COUNT; pin++) {
+            EXPECT_FALSE(output[pin]) << "pin " << (int)pin;
+        }
+    }
+
+    unsigned reads_per_scan() {
+        pin_reads = 0;
+        matrix_scan();
+        return pin_reads;
+    }
+};
+
+TEST_F(MatrixIdleWakeup, FullScansUntilTheIdleDelay) {
+    advance_time(MATRIX_IDLE_WAKEUP_DELAY - 1);
+    EXPECT_EQ(reads_per_scan(), (unsigned)(MATRIX_ROWS * MATRIX_COLS));
+    EXPECT_FALSE(parked());
+    expect_pins_unselected();
+
+    advance_time(1);
+    matrix_scan();
+    EXPECT_TRUE(parked());
+}
+
+TEST_F(MatrixIdleWakeup, ParkedScanReadsOneLine) {
+    park();
+    edge_waits = 0;
+    for (int i = 0; i < 10; i++) {
+        EXPECT_EQ(reads_per_scan(), (unsigned)(MATRIX_ROWS * MATRIX_COLS / SELECT_COUNT));
+        EXPECT_TRUE(parked());
+    }
+    EXPECT_EQ(edge_waits, 10u);
+}
+
+TEST_F(MatrixIdleWakeup, AnyKeyIsReportedInTheParkedScan) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            park();
+
+            pressed[row][col] = true;
+            EXPECT_TRUE(matrix_scan());
+            for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+                EXPECT_EQ(matrix[r], r == row ? MATRIX_ROW_SHIFTER << col : 0) << "key " << (int)row << "," << (int)col;
+            }
+            expect_pins_unselected();
+
+            pressed[row][col] = false;
+            EXPECT_TRUE(matrix_scan());
+            EXPECT_EQ(matrix[row], 0);
+        }
+    }
+}
+
+TEST_F(MatrixIdleWakeup, HeldKeyKeepsTheMatrixAwake) {
+    park();
+    pressed[1][2] = true;
+    matrix_scan();
+
+    advance_time(MATRIX_IDLE_WAKEUP_DELAY * 4);
+    EXPECT_EQ(reads_per_scan(), (unsigned)(MATRIX_ROWS * MATRIX_COLS));
+    EXPECT_FALSE(parked());
+
+    // The idle delay starts again from the release
+    pressed[1][2] = false;
+    matrix_scan();
+    advance_time(MATRIX_IDLE_WAKEUP_DELAY - 1);
+    matrix_scan();
+    EXPECT_FALSE(parked());
+    advance_time(1);
+    matrix_scan();
+    EXPECT_TRUE(parked());
+}
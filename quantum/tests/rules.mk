@@ -0,0 +1,11 @@
+matrix_idle_wakeup_col2row_DEFS := -DNO_DEBUG -DIGNORE_ATOMIC_BLOCK
+matrix_idle_wakeup_col2row_CONFIG := $(QUANTUM_PATH)/tests/config_matrix_idle_wakeup.h
+
+matrix_idle_wakeup_col2row_SRC := \
+	$(QUANTUM_PATH)/tests/matrix_idle_wakeup_tests.cpp \
+	$(QUANTUM_PATH)/matrix.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+matrix_idle_wakeup_row2col_DEFS := $(matrix_idle_wakeup_col2row_DEFS) -DDIODE_DIRECTION=ROW2COL
+matrix_idle_wakeup_row2col_CONFIG := $(matrix_idle_wakeup_col2row_CONFIG)
+matrix_idle_wakeup_row2col_SRC := $(matrix_idle_wakeup_col2row_SRC)
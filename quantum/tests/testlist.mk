@@ -0,0 +1,3 @@
+TEST_LIST += \
+	matrix_idle_wakeup_col2row \
+	matrix_idle_wakeup_row2col
@@ -1,12 +1,17 @@
 // Copyright 2021 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "keycode.h"
 #include "test_common.hpp"
 
 using ::testing::_;
 using ::testing::AnyNumber;
 using ::testing::InSequence;
+using ::testing::Invoke;
 
 class AutoCorrect : public TestFixture {
    public:
@@ -202,3 +207,156 @@ TEST_F(AutoCorrect, overture_should_not_autocorrect) {
 
     VERIFY_AND_CLEAR(driver);
 }
+
+// Every entry of autocorrect_data_default.h, ':' standing for a word break
+static const std::vector<std::pair<std::string, std::string>> default_entries = {
+    {":guage", "gauge"},
+    {":the:the:", "the"},
+    {":thier", "their"},
+    {":ture", "true"},
+    {"accomodate", "accommodate"},
+    {"acommodate", "accommodate"},
+    {"aparent", "apparent"},
+    {"aparrent", "apparent"},
+    {"apparant", "apparent"},
+    {"apparrent", "apparent"},
+    {"aquire", "acquire"},
+    {"becuase", "because"},
+    {"cauhgt", "caught"},
+    {"cheif", "chief"},
+    {"choosen", "chosen"},
+    {"cieling", "ceiling"},
+    {"collegue", "colleague"},
+    {"concensus", "consensus"},
+    {"contians", "contains"},
+    {"cosnt", "const"},
+    {"dervied", "derived"},
+    {"fales", "false"},
+    {"fasle", "false"},
+    {"fitler", "filter"},
+    {"flase", "false"},
+    {"foward", "forward"},
+    {"frequecy", "frequency"},
+    {"gaurantee", "guarantee"},
+    {"guaratee", "guarantee"},
+    {"heigth", "height"},
+    {"heirarchy", "hierarchy"},
+    {"inclued", "include"},
+    {"interator", "iterator"},
+    {"intput", "input"},
+    {"invliad", "invalid"},
+    {"lenght", "length"},
+    {"liasion", "liaison"},
+    {"libary", "library"},
+    {"listner", "listener"},
+    {"looses:", "loses"},
+    {"looup", "lookup"},
+    {"manefist", "manifest"},
+    {"namesapce", "namespace"},
+    {"namespcae", "namespace"},
+    {"occassion", "occasion"},
+    {"occured", "occurred"},
+    {"ouptut", "output"},
+    {"ouput", "output"},
+    {"overide", "override"},
+    {"postion", "position"},
+    {"priviledge", "privilege"},
+    {"psuedo", "pseudo"},
+    {"recieve", "receive"},
+    {"refered", "referred"},
+    {"relevent", "relevant"},
+    {"repitition", "repetition"},
+    {"retrun", "return"},
+    {"retun", "return"},
+    {"reuslt", "result"},
+    {"reutrn", "return"},
+    {"saftey", "safety"},
+    {"seperate", "separate"},
+    {"singed", "signed"},
+    {"stirng", "string"},
+    {"strign", "string"},
+    {"swithc", "switch"},
+    {"swtich", "switch"},
+    {"thresold", "threshold"},
+    {"udpate", "update"},
+    {"widht", "width"},
+};
+
+class AutoCorrectDefaultData : public AutoCorrect, public ::testing::WithParamInterface<std::pair<std::string, std::string>> {
+   protected:
+    std::vector<KeymapKey> keys;
+    std::string            text;
+
+    void SetUp() override {
+        AutoCorrect::SetUp();
+        for (uint8_t i = 0; i < 26; i++) {
+            keys.push_back(KeymapKey(0, i % MATRIX_COLS, i / MATRIX_COLS, KC_A + i));
+        }
+        keys.push_back(KeymapKey(0, 6, 2, KC_QUOTE));
+        keys.push_back(KeymapKey(0, 7, 2, KC_SPACE));
+        for (const auto &key : keys) {
+            add_key(key);
+        }
+    }
+
+    void TapChar(char c) {
+        TapKey(c == ':' ? keys[27] : c == '\'' ? keys[26] : keys[c - 'a']);
+    }
+
+    // Keeps track of the text on the host, by following the keys pressed in each report
+    void RecordText(TestDriver &driver) {
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([this](report_keyboard_t &report) {
+            for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+                uint8_t keycode = report.keys[i];
+                if (keycode == KC_BACKSPACE) {
+                    text.pop_back();
+                } else if (keycode == KC_SPACE) {
+                    text.push_back(':');
+                } else if (keycode == KC_QUOTE) {
+                    text.push_back('\'');
+                } else if (keycode >= KC_A && keycode <= KC_Z) {
+                    text.push_back(keycode - KC_A + 'a');
+                }
+            }
+        }));
+    }
+};
+
+// Test that every typo in the default dictionary is found and corrected
+TEST_P(AutoCorrectDefaultData, typo_is_corrected) {
+    TestDriver driver;
+    RecordText(driver);
+
+    const std::string &typo       = GetParam().first;
+    const std::string &correction = GetParam().second;
+    for (char c : ":" + typo) {
+        TapChar(c);
+    }
+
+    // A word break at the start or the end of the typo is kept
+    std::string expected = ":" + correction + (typo.back() == ':' ? ":" : "");
+    EXPECT_EQ(text.substr(text.size() - std::min(text.size(), expected.size())), expected);
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Test that the correction of every typo in the default dictionary is left alone
+TEST_P(AutoCorrectDefaultData, correction_is_not_changed) {
+    TestDriver driver;
+    RecordText(driver);
+
+    std::string word = ":" + GetParam().second + ":";
+    for (char c : word) {
+        TapChar(c);
+    }
+
+    EXPECT_EQ(text, word);
+    VERIFY_AND_CLEAR(driver);
+}
+
+INSTANTIATE_TEST_CASE_P(DefaultEntries, AutoCorrectDefaultData, ::testing::ValuesIn(default_entries), [](const ::testing::TestParamInfo<std::pair<std::string, std::string>> &info) {
+    std::string name;
+    for (char c : info.param.first) {
+        if (c >= 'a' && c <= 'z') name.push_back(c);
+    }
+    return name + "_" + std::to_string(info.index);
+});
@@ -0,0 +1,47 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+#define COMBO_INDEX_COMBO_COUNT 4
+#define COMBO_INDEX_KEYCODE_COUNT 5
+#define COMBO_INDEX_SORTED
+
+static const uint16_t PROGMEM combo_index_keycodes[COMBO_INDEX_KEYCODE_COUNT] = {
+    KC_A,
+    KC_B,
+    KC_C,
+    KC_D,
+    KC_ENTER,
+};
+
+// Where each keycode's combos start in combo_index_combos[], the last entry marks the end
+static const uint16_t PROGMEM combo_index_offsets[COMBO_INDEX_KEYCODE_COUNT + 1] = {
+    0, 2, 5, 6, 7, 9
+};
+
+static const uint16_t PROGMEM combo_index_combos[9] = {
+    0, 3, 0, 1, 3, 1, 2, 2, 3
+};
@@ -0,0 +1,7 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+COMBO_ENABLE = yes
+COMBO_INDEX_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = test_combos.c
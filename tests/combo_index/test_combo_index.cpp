@@ -0,0 +1,82 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "quantum.h"
+#include "keycode.h"
+#include "test_common.h"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+}
+
+using testing::_;
+using testing::ElementsAre;
+using testing::InSequence;
+using testing::IsEmpty;
+
+class ComboIndex : public TestFixture {
+   protected:
+    static std::vector<uint16_t> combos_for(uint16_t keycode) {
+        std::vector<uint16_t> combos;
+        uint16_t              begin, end;
+        EXPECT_TRUE(combo_index_find(keycode, &begin, &end));
+        for (uint16_t entry = begin; entry < end; ++entry) {
+            combos.push_back(combo_index_get(entry));
+        }
+        return combos;
+    }
+};
+
+/* Combo numbers follow the combos enum in test_combos.c */
+TEST_F(ComboIndex, keycodes_map_to_the_combos_containing_them) {
+    EXPECT_THAT(combos_for(KC_A), ElementsAre(0, 3));
+    EXPECT_THAT(combos_for(KC_B), ElementsAre(0, 1, 3));
+    EXPECT_THAT(combos_for(KC_C), ElementsAre(1));
+    EXPECT_THAT(combos_for(KC_D), ElementsAre(2));
+    EXPECT_THAT(combos_for(KC_X), IsEmpty());
+}
+
+TEST_F(ComboIndex, aliases_share_an_entry) {
+    EXPECT_THAT(combos_for(KC_ENT), ElementsAre(2, 3));
+    EXPECT_THAT(combos_for(KC_ENTER), ElementsAre(2, 3));
+}
+
+TEST_F(ComboIndex, indexed_combo_fires) {
+    TestDriver driver;
+    KeymapKey  key_b(0, 0, 1, KC_B);
+    KeymapKey  key_c(0, 0, 2, KC_C);
+    set_keymap({key_b, key_c});
+
+    EXPECT_REPORT(driver, (KC_TAB));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_b, key_c});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, combo_written_with_alias_fires) {
+    TestDriver driver;
+    KeymapKey  key_enter(0, 0, 1, KC_ENTER);
+    KeymapKey  key_d(0, 0, 2, KC_D);
+    set_keymap({key_enter, key_d});
+
+    EXPECT_REPORT(driver, (KC_DELETE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_enter, key_d});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, key_outside_the_index_is_not_held_back) {
+    TestDriver driver;
+    KeymapKey  key_x(0, 0, 1, KC_X);
+    set_keymap({key_x});
+
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_x);
+    VERIFY_AND_CLEAR(driver);
+}
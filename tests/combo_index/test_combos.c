@@ -0,0 +1,19 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum combos { ab_esc, bc_tab, ent_del, abc_caps };
+
+uint16_t const ab_combo[]  = {KC_A, KC_B, COMBO_END};
+uint16_t const bc_combo[]  = {KC_B, KC_C, COMBO_END};
+uint16_t const ent_combo[] = {KC_ENT, KC_D, COMBO_END};
+uint16_t const abc_combo[] = {KC_A, KC_B, KC_ENTER, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [ab_esc]   = COMBO(ab_combo, KC_ESC),
+    [bc_tab]   = COMBO(bc_combo, KC_TAB),
+    [ent_del]  = COMBO(ent_combo, KC_DEL),
+    [abc_caps] = COMBO(abc_combo, KC_CAPS),
+};
+// clang-format on
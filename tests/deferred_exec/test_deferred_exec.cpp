@@ -0,0 +1,199 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+
+void advance_time(uint32_t ms);
+}
+
+#define TABLE_SIZE 8
+
+static deferred_executor_t table[TABLE_SIZE];
+static uint32_t            last_exec;
+
+struct call_t {
+    int      id;
+    uint32_t trigger_time;
+    uint32_t now;
+};
+
+static std::vector<call_t> calls;
+static uint32_t            repeat_delay;
+static deferred_token      token_to_cancel;
+
+static uint32_t record_call(uint32_t trigger_time, void *cb_arg) {
+    calls.push_back({(int)(intptr_t)cb_arg, trigger_time, timer_read32()});
+    return repeat_delay;
+}
+
+static uint32_t cancel_other(uint32_t trigger_time, void *cb_arg) {
+    record_call(trigger_time, cb_arg);
+    cancel_deferred_exec_advanced(table, TABLE_SIZE, token_to_cancel);
+    return 0;
+}
+
+class DeferredExec : public TestFixture {
+   protected:
+    void SetUp() override {
+        memset(table, 0, sizeof(table));
+        last_exec       = timer_read32();
+        repeat_delay    = 0;
+        token_to_cancel = INVALID_DEFERRED_TOKEN;
+        calls.clear();
+    }
+
+    deferred_token defer(uint32_t delay_ms, int id, deferred_exec_callback callback = record_call) {
+        return defer_exec_advanced(table, TABLE_SIZE, delay_ms, callback, (void *)(intptr_t)id);
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_advanced_task(table, TABLE_SIZE, &last_exec);
+        }
+    }
+
+    std::vector<int> call_order() {
+        std::vector<int> ids;
+        for (auto &call : calls) {
+            ids.push_back(call.id);
+        }
+        return ids;
+    }
+};
+
+TEST_F(DeferredExec, ExecutesInDeadlineOrder) {
+    uint32_t start = timer_read32();
+
+    defer(30, 3);
+    defer(10, 1);
+    defer(20, 2);
+    defer(15, 4);
+
+    run_for(40);
+    EXPECT_EQ(call_order(), std::vector<int>({1, 4, 2, 3}));
+    for (auto &call : calls) {
+        EXPECT_EQ(call.now, call.trigger_time);
+    }
+    EXPECT_EQ(calls[0].trigger_time, start + 10);
+    EXPECT_EQ(deferred_exec_advanced_next_delay(table, TABLE_SIZE), DEFERRED_EXEC_IDLE);
+}
+
+TEST_F(DeferredExec, CancelAndExtend) {
+    defer(10, 1);
+    deferred_token cancelled = defer(20, 2);
+    deferred_token extended  = defer(30, 3);
+    defer(40, 4);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, TABLE_SIZE, cancelled));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, TABLE_SIZE, cancelled));
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, TABLE_SIZE, extended, 50));
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, TABLE_SIZE, cancelled, 50));
+
+    run_for(60);
+    EXPECT_EQ(call_order(), std::vector<int>({1, 4, 3}));
+}
+
+TEST_F(DeferredExec, RepeatKeepsCadence) {
+    repeat_delay         = 10;
+    deferred_token token = defer(10, 1);
+
+    run_for(35);
+    ASSERT_EQ(calls.size(), 3);
+    EXPECT_EQ(calls[1].trigger_time - calls[0].trigger_time, 10);
+    EXPECT_EQ(calls[2].trigger_time - calls[1].trigger_time, 10);
+    EXPECT_EQ(deferred_exec_advanced_next_delay(table, TABLE_SIZE), 5);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, TABLE_SIZE, token));
+    run_for(20);
+    EXPECT_EQ(calls.size(), 3);
+}
+
+TEST_F(DeferredExec, CallbackCanCancelAnotherExecutor) {
+    defer(10, 1, cancel_other);
+    token_to_cancel = defer(10, 2);
+    defer(20, 3);
+
+    run_for(30);
+    EXPECT_EQ(call_order(), std::vector<int>({1, 3}));
+}
+
+TEST_F(DeferredExec, NextDelay) {
+    EXPECT_EQ(deferred_exec_advanced_next_delay(table, TABLE_SIZE), DEFERRED_EXEC_IDLE);
+
+    defer(25, 1);
+    defer(12, 2);
+    EXPECT_EQ(deferred_exec_advanced_next_delay(table, TABLE_SIZE), 12);
+
+    // Due, but the task hasn't run yet
+    advance_time(12);
+    EXPECT_EQ(deferred_exec_advanced_next_delay(table, TABLE_SIZE), 0);
+    deferred_exec_advanced_task(table, TABLE_SIZE, &last_exec);
+    EXPECT_EQ(deferred_exec_advanced_next_delay(table, TABLE_SIZE), 13);
+}
+
+TEST_F(DeferredExec, FullTableIsRejected) {
+    for (int i = 0; i < TABLE_SIZE; i++) {
+        EXPECT_NE(defer(10 + i, i), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer(5, TABLE_SIZE), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer(0, TABLE_SIZE), INVALID_DEFERRED_TOKEN);
+
+    run_for(20);
+    EXPECT_EQ(calls.size(), TABLE_SIZE);
+    EXPECT_NE(defer(5, TABLE_SIZE), INVALID_DEFERRED_TOKEN);
+}
+
+TEST_F(DeferredExec, RandomOperationsMatchReference) {
+    struct pending_t {
+        deferred_token token;
+        int            id;
+    };
+    std::vector<pending_t> pending;
+
+    srand(1234);
+    for (int step = 0; step < 2000; step++) {
+        switch (rand() % 4) {
+            case 0:
+            case 1: {
+                deferred_token token = defer(1 + rand() % 50, step);
+                if (pending.size() < TABLE_SIZE) {
+                    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+                    pending.push_back({token, step});
+                } else {
+                    ASSERT_EQ(token, INVALID_DEFERRED_TOKEN);
+                }
+                break;
+            }
+            case 2:
+                if (!pending.empty()) {
+                    size_t victim = rand() % pending.size();
+                    EXPECT_TRUE(cancel_deferred_exec_advanced(table, TABLE_SIZE, pending[victim].token));
+                    pending.erase(pending.begin() + victim);
+                }
+                break;
+            case 3: {
+                size_t before = calls.size();
+                run_for(1 + rand() % 10);
+                for (size_t i = before; i < calls.size(); i++) {
+                    // Every executor that ran was pending, ran on time and in trigger order
+                    auto it = std::find_if(pending.begin(), pending.end(), [&](const pending_t &p) { return p.id == calls[i].id; });
+                    ASSERT_NE(it, pending.end());
+                    EXPECT_EQ(calls[i].now, calls[i].trigger_time);
+                    if (i > 0) {
+                        EXPECT_LE(calls[i - 1].trigger_time, calls[i].trigger_time);
+                    }
+                    pending.erase(it);
+                }
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define DYNAMIC_KEYMAP_RAM_CACHE
+#define DYNAMIC_KEYMAP_LAYER_COUNT 2
+#define TRANSIENT_EEPROM_SIZE 512
+
+// Pointers are wider than int on the host, keep the EEPROM addresses the same width
+#define DYNAMIC_KEYMAP_EEPROM_ADDR ((uintptr_t)EECONFIG_SIZE)
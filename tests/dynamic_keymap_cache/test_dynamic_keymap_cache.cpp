@@ -0,0 +1,125 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "eeprom.h"
+}
+
+class DynamicKeymapCache : public TestFixture {
+   protected:
+    void SetUp() override {
+        dynamic_keymap_reset();
+    }
+
+    uint16_t keycode_in_eeprom(uint8_t layer, uint8_t row, uint8_t column) {
+        uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, column);
+        return (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+    }
+};
+
+TEST_F(DynamicKeymapCache, SetKeycodeIsVisibleStraightAway) {
+    uint16_t before = keycode_in_eeprom(1, 2, 3);
+
+    dynamic_keymap_set_keycode(1, 2, 3, KC_B);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), KC_B);
+    EXPECT_EQ(keycode_in_eeprom(1, 2, 3), before);
+
+    uint8_t buffer[2];
+    dynamic_keymap_get_buffer((1 * MATRIX_ROWS * MATRIX_COLS + 2 * MATRIX_COLS + 3) * 2, sizeof(buffer), buffer);
+    EXPECT_EQ((buffer[0] << 8) | buffer[1], KC_B);
+}
+
+TEST_F(DynamicKeymapCache, WritesAreCoalescedUntilIdle) {
+    TestDriver driver;
+
+    dynamic_keymap_set_keycode(0, 0, 0, KC_A);
+    idle_for(DYNAMIC_KEYMAP_WRITE_BACK_DELAY / 2);
+    dynamic_keymap_set_keycode(0, 1, 1, KC_C);
+    idle_for(DYNAMIC_KEYMAP_WRITE_BACK_DELAY / 2);
+
+    // Still within the delay of the last write
+    EXPECT_EQ(keycode_in_eeprom(0, 0, 0), KC_NO);
+    EXPECT_EQ(keycode_in_eeprom(0, 1, 1), KC_NO);
+
+    idle_for(DYNAMIC_KEYMAP_WRITE_BACK_DELAY / 2 + 1);
+    EXPECT_EQ(keycode_in_eeprom(0, 0, 0), KC_A);
+    EXPECT_EQ(keycode_in_eeprom(0, 1, 1), KC_C);
+}
+
+TEST_F(DynamicKeymapCache, SetBufferIsClampedToTheKeymap) {
+    const uint16_t keymap_size = dynamic_keymap_get_layer_count() * MATRIX_ROWS * MATRIX_COLS * 2;
+    uint8_t        data[4]     = {0x00, KC_D, 0x00, KC_E};
+
+    dynamic_keymap_set_buffer(keymap_size - 2, sizeof(data), data);
+    dynamic_keymap_flush();
+
+    uint8_t layer = dynamic_keymap_get_layer_count() - 1;
+    EXPECT_EQ(dynamic_keymap_get_keycode(layer, MATRIX_ROWS - 1, MATRIX_COLS - 1), KC_D);
+    EXPECT_EQ(keycode_in_eeprom(layer, MATRIX_ROWS - 1, MATRIX_COLS - 1), KC_D);
+
+    uint8_t buffer[4];
+    dynamic_keymap_get_buffer(keymap_size - 2, sizeof(buffer), buffer);
+    EXPECT_EQ(buffer[1], KC_D);
+    EXPECT_EQ(buffer[2], 0);
+    EXPECT_EQ(buffer[3], 0);
+}
+
+TEST_F(DynamicKeymapCache, LookupBenchmark) {
+    const unsigned rounds = 2000;
+    const uint8_t  layers = dynamic_keymap_get_layer_count();
+
+    for (uint8_t layer = 0; layer < layers; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                dynamic_keymap_set_keycode(layer, row, column, KC_A + ((layer + row + column) % 26));
+            }
+        }
+    }
+    dynamic_keymap_flush();
+
+    volatile uint32_t sink    = 0;
+    unsigned          lookups = rounds * layers * MATRIX_ROWS * MATRIX_COLS;
+
+    // What dynamic_keymap_get_keycode() does without the cache
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < rounds; i++) {
+        for (uint8_t layer = 0; layer < layers; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                    sink = sink + keycode_in_eeprom(layer, row, column);
+                }
+            }
+        }
+    }
+    double eeprom_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / lookups;
+
+    start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < rounds; i++) {
+        for (uint8_t layer = 0; layer < layers; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                    sink = sink + dynamic_keymap_get_keycode(layer, row, column);
+                }
+            }
+        }
+    }
+    double cached_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / lookups;
+
+    for (uint8_t layer = 0; layer < layers; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                ASSERT_EQ(dynamic_keymap_get_keycode(layer, row, column), keycode_in_eeprom(layer, row, column));
+            }
+        }
+    }
+
+    // The test platform's EEPROM is a plain array, so this understates the cost of a real EEPROM or wear-leveling backend
+    printf("[ BENCH    ] %-8s %6.2f ns/lookup\n", "eeprom", eeprom_ns);
+    printf("[ BENCH    ] %-8s %6.2f ns/lookup\n", "cached", cached_ns);
+}
@@ -0,0 +1,217 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "process_key_override.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+static key_override_t make_override(uint8_t trigger_mods, uint16_t trigger, uint16_t replacement) {
+    key_override_t override  = {};
+    override.trigger         = trigger;
+    override.trigger_mods    = trigger_mods;
+    override.layers          = ~0;
+    override.suppressed_mods = trigger_mods;
+    override.replacement     = replacement;
+    override.options         = ko_options_default;
+    return override;
+}
+
+class KeyOverride : public TestFixture {
+   protected:
+    // Every list is kept for the whole test, so that each one is at a different address
+    std::list<std::vector<key_override_t>>        overrides;
+    std::list<std::vector<const key_override_t *>> override_lists;
+
+    // Points key_overrides at a new list, which the index has to pick up
+    void use_overrides(std::vector<key_override_t> list) {
+        overrides.push_back(list);
+        override_lists.emplace_back();
+        for (const auto &override : overrides.back()) {
+            override_lists.back().push_back(&override);
+        }
+        override_lists.back().push_back(nullptr);
+        key_overrides = override_lists.back().data();
+    }
+
+    void TearDown() override {
+        key_overrides = nullptr;
+        TestFixture::TearDown();
+    }
+};
+
+TEST_F(KeyOverride, ShiftBackspaceSendsDelete) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  shift(0, 0, 0, KC_LEFT_SHIFT);
+    KeymapKey  backspace(0, 1, 0, KC_BACKSPACE);
+    set_keymap({shift, backspace});
+    use_overrides({make_override(MOD_MASK_SHIFT, KC_BACKSPACE, KC_DELETE)});
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_DELETE));
+    backspace.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    backspace.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, FirstListedOverrideWins) {
+    TestDriver driver;
+    KeymapKey  control(0, 0, 0, KC_LEFT_CTRL);
+    KeymapKey  shift(0, 1, 0, KC_LEFT_SHIFT);
+    KeymapKey  key_a(0, 2, 0, KC_A);
+    set_keymap({control, shift, key_a});
+
+    const key_override_t control_a       = make_override(MOD_MASK_CTRL, KC_A, KC_B);
+    const key_override_t control_shift_a = make_override(MOD_MASK_CS, KC_A, KC_C);
+
+    for (bool control_a_first : {true, false}) {
+        if (control_a_first) {
+            use_overrides({make_override(MOD_MASK_SHIFT, KC_Z, KC_X), control_a, control_shift_a});
+        } else {
+            use_overrides({control_shift_a, make_override(MOD_MASK_SHIFT, KC_Z, KC_X), control_a});
+        }
+
+        EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+        if (control_a_first) {
+            // Only the control is suppressed, so shift stays down
+            EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_B));
+        } else {
+            EXPECT_REPORT(driver, (KC_C));
+        }
+        control.press();
+        run_one_scan_loop();
+        shift.press();
+        run_one_scan_loop();
+        key_a.press();
+        run_one_scan_loop();
+        key_a.release();
+        run_one_scan_loop();
+        shift.release();
+        run_one_scan_loop();
+        control.release();
+        run_one_scan_loop();
+        VERIFY_AND_CLEAR(driver);
+    }
+}
+
+TEST_F(KeyOverride, ModifierPressedAfterTheTriggerActivates) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  control(0, 0, 0, KC_LEFT_CTRL);
+    KeymapKey  key_a(0, 1, 0, KC_A);
+    set_keymap({control, key_a});
+    use_overrides({make_override(MOD_MASK_SHIFT, KC_Z, KC_X), make_override(MOD_MASK_CTRL, KC_A, KC_B)});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The replacement waits for the key repeat delay since the trigger went down
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_B));
+    control.press();
+    idle_for(KEY_OVERRIDE_REPEAT_DELAY);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    control.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, OverrideWithoutTrigger) {
+    TestDriver driver;
+    KeymapKey  gui(0, 0, 0, KC_LEFT_GUI);
+    KeymapKey  alt(0, 1, 0, KC_LEFT_ALT);
+    set_keymap({gui, alt});
+    use_overrides({make_override(MOD_MASK_SHIFT, KC_Z, KC_X), make_override(MOD_MASK_GUI | MOD_MASK_ALT, KC_NO, KC_ESCAPE)});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    gui.press();
+    run_one_scan_loop();
+    // Without a trigger there is no key down to measure the key repeat delay from
+    alt.press();
+    idle_for(KEY_OVERRIDE_REPEAT_DELAY);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_EMPTY_REPORT(driver);
+    alt.release();
+    run_one_scan_loop();
+    gui.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, LookupBenchmark) {
+    TestDriver driver;
+    KeymapKey  shift(0, 0, 0, KC_LEFT_SHIFT);
+    KeymapKey  key_a(0, 1, 0, KC_A);
+    set_keymap({shift, key_a});
+
+    const unsigned presses = 2000;
+
+    for (unsigned count : {5, 50, 200}) {
+        // The override for the key being pressed comes last, after overrides of every other trigger
+        std::vector<key_override_t> list;
+        for (unsigned i = 0; i < count - 1; i++) {
+            list.push_back(make_override(MOD_MASK_SHIFT, KC_F1 + (i % 24), KC_B));
+        }
+        list.push_back(make_override(MOD_MASK_SHIFT, KC_A, KC_Z));
+        use_overrides(list);
+
+        EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+        EXPECT_REPORT(driver, (KC_Z)).Times(presses);
+        shift.press();
+        run_one_scan_loop();
+
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < presses; i++) {
+            key_a.press();
+            run_one_scan_loop();
+            key_a.release();
+            run_one_scan_loop();
+        }
+        double ns_per_press = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / presses;
+
+        shift.release();
+        run_one_scan_loop();
+        VERIFY_AND_CLEAR(driver);
+
+        printf("[ BENCH    ] %3u overrides %8.1f ns/press and release\n", count, ns_per_press);
+    }
+}
@@ -0,0 +1,91 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+class KeyReport : public TestFixture {};
+
+TEST_F(KeyReport, UnchangedReportIsNotSentAgain) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A)).Times(1);
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(report_keys_changed());
+    EXPECT_NO_REPORT(driver);
+    send_keyboard_report();
+    send_keyboard_report();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyReport, SameKeycodeOnTwoKeysIsHeldOnce) {
+    TestDriver driver;
+    auto       key_a1 = KeymapKey(0, 0, 0, KC_A);
+    auto       key_a2 = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_a1, key_a2});
+
+    // The second press taps the key again rather than adding it twice
+    EXPECT_REPORT(driver, (KC_A)).Times(2);
+    EXPECT_EMPTY_REPORT(driver);
+    key_a1.press();
+    run_one_scan_loop();
+    key_a2.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(has_anykey(), 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a1.release();
+    run_one_scan_loop();
+    key_a2.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(has_anykey(), 0);
+}
+
+TEST_F(KeyReport, KeysBeyondSixAreHeldButNotReported) {
+    TestDriver             driver;
+    std::vector<KeymapKey> keys;
+    const uint8_t          codes[] = {KC_A, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G};
+
+    for (uint8_t i = 0; i < sizeof(codes); i++) {
+        keys.push_back(KeymapKey(0, i, 0, codes[i]));
+    }
+    for (auto &key : keys) {
+        add_key(key);
+    }
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(6);
+    for (auto &key : keys) {
+        key.press();
+        run_one_scan_loop();
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(has_anykey(), 7);
+    EXPECT_TRUE(is_key_pressed(KC_F));
+    EXPECT_FALSE(is_key_pressed(KC_G));
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(6);
+    for (auto &key : keys) {
+        key.release();
+        run_one_scan_loop();
+    }
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(has_anykey(), 0);
+}
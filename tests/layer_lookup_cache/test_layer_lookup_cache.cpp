@@ -0,0 +1,91 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LayerLookupCache : public TestFixture {};
+
+TEST_F(LayerLookupCache, TransparentKeyFollowsLayerChanges) {
+    TestDriver driver;
+    KeymapKey  key = KeymapKey{0, 0, 0, KC_A};
+
+    set_keymap({key, KeymapKey{1, 0, 0, KC_TRNS}, KeymapKey{2, 0, 0, KC_B}});
+
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+
+    layer_on(2);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 2);
+
+    EXPECT_REPORT(driver, (KC_B));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    layer_off(2);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookupCache, DirectLayerStateWritesAreNoticed) {
+    TestDriver driver;
+    KeymapKey  key = KeymapKey{0, 0, 0, KC_A};
+
+    set_keymap({key, KeymapKey{1, 0, 0, KC_B}});
+
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+
+    layer_state = (layer_state_t)1 << 1;
+    EXPECT_EQ(layer_switch_get_layer(key.position), 1);
+
+    layer_state         = 0;
+    default_layer_state = (layer_state_t)1 << 1;
+    EXPECT_EQ(layer_switch_get_layer(key.position), 1);
+
+    default_layer_state = 1;
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookupCache, KeymapChangeIsPickedUpAfterCacheClear) {
+    TestDriver driver;
+    KeymapKey  key = KeymapKey{0, 0, 0, KC_A};
+
+    set_keymap({key, KeymapKey{1, 0, 0, KC_TRNS}});
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+
+    /* Swap the transparent key for a real one, as a runtime keymap edit would. */
+    set_keymap({key, KeymapKey{1, 0, 0, KC_B}});
+    EXPECT_EQ(layer_switch_get_layer(key.position), 1);
+
+    EXPECT_REPORT(driver, (KC_B));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
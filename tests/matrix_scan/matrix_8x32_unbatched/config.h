@@ -0,0 +1,12 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 8
+#define MATRIX_COLS 32
+
+// Dispatches every changed key on its own
+#define MATRIX_EVENT_BATCH_SIZE 1
+
+#include "test_common.h"
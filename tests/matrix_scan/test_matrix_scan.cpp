@@ -0,0 +1,220 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "test_common.hpp"
+
+using testing::_;
+
+static std::vector<keyevent_t> dispatched_events;
+static bool                    process_keypresses = true;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+    dispatched_events.push_back(record->event);
+    return true;
+}
+
+/* The benchmark skips action processing, so that only the matrix diff is timed
+ * rather than the test fixture's keymap lookup. */
+extern "C" bool should_process_keypress(void) {
+    return process_keypresses;
+}
+
+class MatrixScan : public TestFixture {
+   protected:
+    void SetUp() override {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                add_key(KeymapKey(0, col, row, KC_NO));
+            }
+        }
+        dispatched_events.clear();
+        process_keypresses = true;
+    }
+
+    /* Runs `scans` keyboard_task() iterations, calling `between_scans` before
+     * each one, and returns the average time spent per scan. */
+    template <typename F>
+    double benchmark(const char* name, unsigned scans, F between_scans) {
+        using clock = std::chrono::steady_clock;
+
+        std::chrono::nanoseconds total{0};
+        for (unsigned i = 0; i < scans; i++) {
+            between_scans(i);
+            auto start = clock::now();
+            keyboard_task();
+            total += clock::now() - start;
+        }
+
+        double ns_per_scan = (double)total.count() / scans;
+        printf("[ BENCH    ] %ux%u %-26s %8.1f ns/scan\n", MATRIX_ROWS, MATRIX_COLS, name, ns_per_scan);
+        return ns_per_scan;
+    }
+
+    static void toggle_key(uint8_t col, uint8_t row, bool pressed) {
+        if (pressed) {
+            press_key(col, row);
+        } else {
+            release_key(col, row);
+        }
+    }
+};
+
+static const unsigned scan_count = 20000;
+
+#define EXPECT_KEYPOS(key, row_num, col_num) \
+    do {                                     \
+        EXPECT_EQ((key).row, (row_num));     \
+        EXPECT_EQ((key).col, (col_num));     \
+    } while (0)
+
+TEST_F(MatrixScan, ChangedKeysAreDispatchedInMatrixOrder) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    press_key(MATRIX_COLS - 1, 0);
+    press_key(0, MATRIX_ROWS - 1);
+    press_key(0, 0);
+    press_key(MATRIX_COLS / 2, MATRIX_ROWS / 2);
+    run_one_scan_loop();
+
+    ASSERT_EQ(dispatched_events.size(), 4);
+    EXPECT_KEYPOS(dispatched_events[0].key, 0, 0);
+    EXPECT_KEYPOS(dispatched_events[1].key, 0, MATRIX_COLS - 1);
+    EXPECT_KEYPOS(dispatched_events[2].key, MATRIX_ROWS / 2, MATRIX_COLS / 2);
+    EXPECT_KEYPOS(dispatched_events[3].key, MATRIX_ROWS - 1, 0);
+    for (auto& event : dispatched_events) {
+        EXPECT_TRUE(event.pressed);
+    }
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixScan, WholeMatrixChangeIsDispatchedAcrossBatches) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            press_key(col, row);
+        }
+    }
+    run_one_scan_loop();
+
+    ASSERT_EQ(dispatched_events.size(), MATRIX_ROWS * MATRIX_COLS);
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            const keyevent_t& event = dispatched_events[row * MATRIX_COLS + col];
+            EXPECT_KEYPOS(event.key, row, col);
+            EXPECT_TRUE(event.pressed);
+        }
+    }
+
+    dispatched_events.clear();
+    clear_all_keys();
+    run_one_scan_loop();
+
+    ASSERT_EQ(dispatched_events.size(), MATRIX_ROWS * MATRIX_COLS);
+    for (auto& event : dispatched_events) {
+        EXPECT_FALSE(event.pressed);
+    }
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixScan, RandomChangesMatchColumnWalk) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    // The events a plain walk over every column of every row would dispatch
+    static bool          state[MATRIX_ROWS][MATRIX_COLS];
+    std::vector<keypos_t> expected;
+
+    memset(state, 0, sizeof(state));
+    srand(1);
+    for (unsigned scan = 0; scan < 500; scan++) {
+        bool next[MATRIX_ROWS][MATRIX_COLS];
+        memcpy(next, state, sizeof(next));
+
+        // Mostly a few keys at a time, sometimes a whole row or the whole matrix
+        switch (rand() % 8) {
+            case 0:
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    next[scan % MATRIX_ROWS][col] = !next[scan % MATRIX_ROWS][col];
+                }
+                break;
+            case 1:
+                for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                        next[row][col] = rand() % 2;
+                    }
+                }
+                break;
+            default:
+                for (int i = rand() % 4; i >= 0; i--) {
+                    uint8_t row = rand() % MATRIX_ROWS, col = rand() % MATRIX_COLS;
+                    next[row][col] = !next[row][col];
+                }
+                break;
+        }
+
+        expected.clear();
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                if (next[row][col] != state[row][col]) {
+                    expected.push_back({.col = col, .row = row});
+                }
+                toggle_key(col, row, next[row][col]);
+            }
+        }
+        memcpy(state, next, sizeof(state));
+
+        dispatched_events.clear();
+        run_one_scan_loop();
+
+        ASSERT_EQ(dispatched_events.size(), expected.size()) << "scan " << scan;
+        for (size_t i = 0; i < expected.size(); i++) {
+            EXPECT_KEYPOS(dispatched_events[i].key, expected[i].row, expected[i].col);
+            EXPECT_EQ(dispatched_events[i].pressed, state[expected[i].row][expected[i].col]);
+        }
+    }
+
+    clear_all_keys();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixScan, Benchmark) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    process_keypresses = false;
+
+    benchmark("idle", scan_count, [](unsigned) {});
+
+    benchmark("one key, first column", scan_count, [](unsigned i) { toggle_key(0, 0, !(i & 1)); });
+
+    benchmark("one key, last column", scan_count, [](unsigned i) { toggle_key(MATRIX_COLS - 1, MATRIX_ROWS - 1, !(i & 1)); });
+
+    benchmark("one key per row", scan_count, [](unsigned i) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            toggle_key((row * 7) % MATRIX_COLS, row, !(i & 1));
+        }
+    });
+
+    benchmark("whole matrix", scan_count, [](unsigned i) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                toggle_key(col, row, !(i & 1));
+            }
+        }
+    });
+
+    clear_all_keys();
+    run_one_scan_loop();
+    process_keypresses = true;
+    EXPECT_TRUE(dispatched_events.empty());
+    VERIFY_AND_CLEAR(driver);
+}
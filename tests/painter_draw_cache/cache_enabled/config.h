@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Room for four frames of the test image
+#define QUANTUM_PAINTER_DRAW_CACHE_SIZE 1024
@@ -0,0 +1,10 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface
+
+SRC += \
+    tests/painter_draw_cache/test_painter_draw_cache.cpp \
+    tests/painter_draw_cache/graphics/test-image.qgf.c \
+    tests/painter_draw_cache/graphics/test-font.qff.c
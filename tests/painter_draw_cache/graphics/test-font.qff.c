@@ -0,0 +1,22 @@
+// Copyright 2026 QMK -- generated source code only, font retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-font-image --input test-font.png --output . --no-ascii True --unicode-glyphs QMK --format mono2 --no-rle False`
+
+// Font's metadata
+// ---------------
+// Glyphs: K, M, Q
+
+#include <qp.h>
+
+const uint32_t font_test_font_length = 74;
+
+// clang-format off
+const uint8_t font_test_font[74] = {
+    0x00, 0xFF, 0x14, 0x00, 0x00, 0x51, 0x46, 0x46, 0x01, 0x4A, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0xFF,
+    0xFF, 0x09, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x02, 0xFD, 0x12, 0x00, 0x00, 0x4B, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x4D, 0x00, 0x00, 0xC6, 0x01, 0x00, 0x51, 0x00, 0x00, 0x86, 0x03, 0x00,
+    0x04, 0xFB, 0x15, 0x00, 0x00, 0xB2, 0xA2, 0x38, 0x8A, 0x24, 0x02, 0x00, 0x92, 0xE6, 0x79, 0x96,
+    0x24, 0x01, 0x00, 0x8C, 0x14, 0x45, 0x91, 0xC4, 0x20, 0x38,
+};
+// clang-format on
@@ -0,0 +1,11 @@
+// Copyright 2026 QMK -- generated source code only, font retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-font-image --input test-font.png --output . --no-ascii True --unicode-glyphs QMK --format mono2 --no-rle False`
+
+#pragma once
+
+#include <qp.h>
+
+extern const uint32_t font_test_font_length;
+extern const uint8_t  font_test_font[74];
@@ -0,0 +1,24 @@
+// Copyright 2026 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics --input test-image.png --output . --format mono4 --no-rle False --no-deltas False`
+
+// Image's metadata
+// ----------------
+// Width: 12
+// Height: 10
+// Single frame
+
+#include <qp.h>
+
+const uint32_t gfx_test_image_length = 78;
+
+// clang-format off
+const uint8_t gfx_test_image[78] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x4E, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF,
+    0xFF, 0x0C, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0x1E, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFC, 0xFF, 0x1F, 0x0C, 0x00, 0x35, 0x8C, 0x6A, 0x32, 0x8C, 0x9A, 0x32, 0x8C,
+    0xA6, 0x32, 0x8C, 0xA9, 0x32, 0x5C, 0x00, 0x30, 0xF4, 0xFF, 0x3F, 0x01, 0x00, 0x00,
+};
+// clang-format on
@@ -0,0 +1,11 @@
+// Copyright 2026 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics --input test-image.png --output . --format mono4 --no-rle False --no-deltas False`
+
+#pragma once
+
+#include <qp.h>
+
+extern const uint32_t gfx_test_image_length;
+extern const uint8_t  gfx_test_image[78];
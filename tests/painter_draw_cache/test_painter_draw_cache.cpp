@@ -0,0 +1,186 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+#include "graphics/test-image.qgf.h"
+#include "graphics/test-font.qff.h"
+}
+
+/* Built twice, with and without the draw cache. Both builds draw the same scenes onto an RGB565 surface, and must end
+ * up with the same framebuffer contents, recorded below with the cache disabled. */
+
+#define SURFACE_WIDTH 48
+#define SURFACE_HEIGHT 32
+
+// Bytes taken up in the cache by one frame of the test image
+#define IMAGE_BYTES (12 * 10 * 2)
+
+static const uint32_t expected_scene_hash = 0xDB52E3B1;
+
+static uint16_t               framebuffer[SURFACE_HEIGHT][SURFACE_WIDTH];
+static painter_device_t       surface;
+static painter_image_handle_t image;
+static painter_font_handle_t  font;
+
+static uint32_t framebuffer_hash(void) {
+    // FNV-1a
+    const uint8_t *bytes = (const uint8_t *)framebuffer;
+    uint32_t       hash  = 2166136261u;
+    for (size_t i = 0; i < sizeof(framebuffer); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+class PainterDrawCache : public TestFixture {
+   protected:
+    void SetUp() override {
+        if (!surface) {
+            surface = qp_make_rgb565_surface(SURFACE_WIDTH, SURFACE_HEIGHT, framebuffer);
+        }
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+        image = qp_load_image_mem(gfx_test_image);
+        ASSERT_NE(image, nullptr);
+        font = qp_load_font_mem(font_test_font);
+        ASSERT_NE(font, nullptr);
+
+        qp_clear_cache();
+    }
+
+    void TearDown() override {
+        qp_close_image(image);
+        qp_close_font(font);
+    }
+
+    void draw_image(uint16_t x, uint16_t y, uint8_t hue_fg) {
+        ASSERT_TRUE(qp_drawimage_recolor(surface, x, y, image, hue_fg, 255, 255, 0, 0, 0));
+    }
+
+    void draw_scene() {
+        draw_image(0, 0, 0);
+        draw_image(14, 0, 85);
+        draw_image(28, 0, 0);
+        draw_image(0, 12, 85);
+        ASSERT_GT(qp_drawtext_recolor(surface, 14, 12, font, "QMKKMQ", 170, 255, 255, 0, 0, 32), 0);
+        ASSERT_GT(qp_drawtext_recolor(surface, 14, 22, font, "MQK", 170, 255, 255, 0, 0, 32), 0);
+    }
+
+    painter_cache_stats_t stats() {
+        painter_cache_stats_t stats;
+        qp_get_cache_stats(&stats);
+        return stats;
+    }
+};
+
+TEST_F(PainterDrawCache, OutputMatchesUncachedDraw) {
+    draw_scene();
+    uint32_t first = framebuffer_hash();
+    EXPECT_EQ(first, expected_scene_hash);
+
+    // Drawing again on a clean surface takes everything from the cache, when enabled
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    draw_scene();
+    EXPECT_EQ(framebuffer_hash(), first);
+}
+
+#if (QUANTUM_PAINTER_DRAW_CACHE_SIZE) > 0
+
+TEST_F(PainterDrawCache, MissThenHit) {
+    draw_image(0, 0, 0);
+    EXPECT_EQ(stats().misses, 1u);
+    EXPECT_EQ(stats().hits, 0u);
+    EXPECT_EQ(stats().bytes_used, (uint32_t)IMAGE_BYTES);
+
+    draw_image(20, 10, 0);
+    EXPECT_EQ(stats().misses, 1u);
+    EXPECT_EQ(stats().hits, 1u);
+    EXPECT_EQ(stats().bytes_used, (uint32_t)IMAGE_BYTES);
+}
+
+TEST_F(PainterDrawCache, ColorsAreCachedSeparately) {
+    draw_image(0, 0, 0);
+    draw_image(0, 0, 85);
+    EXPECT_EQ(stats().misses, 2u);
+    EXPECT_EQ(stats().bytes_used, (uint32_t)(2 * IMAGE_BYTES));
+
+    draw_image(0, 0, 0);
+    draw_image(0, 0, 85);
+    EXPECT_EQ(stats().hits, 2u);
+}
+
+TEST_F(PainterDrawCache, GlyphsAreCached) {
+    ASSERT_GT(qp_drawtext(surface, 0, 0, font, "QMKQMK"), 0);
+    EXPECT_EQ(stats().misses, 3u);
+    EXPECT_EQ(stats().hits, 3u);
+}
+
+TEST_F(PainterDrawCache, LeastRecentlyDrawnIsEvicted) {
+    // Fills the cache with four colors of the image
+    for (uint8_t hue = 0; hue < 4; hue++) {
+        draw_image(0, 0, hue);
+    }
+    EXPECT_EQ(stats().evictions, 0u);
+    EXPECT_EQ(stats().bytes_used, (uint32_t)(4 * IMAGE_BYTES));
+
+    // Makes the first color the most recently drawn, so the second one is dropped to make room for a fifth
+    draw_image(0, 0, 0);
+    draw_image(0, 0, 4);
+    EXPECT_EQ(stats().evictions, 1u);
+    EXPECT_EQ(stats().bytes_used, (uint32_t)(4 * IMAGE_BYTES));
+
+    painter_cache_stats_t before = stats();
+    draw_image(0, 0, 0);
+    EXPECT_EQ(stats().hits, before.hits + 1);
+    draw_image(0, 0, 1);
+    EXPECT_EQ(stats().misses, before.misses + 1);
+}
+
+TEST_F(PainterDrawCache, ClearCacheDropsEntriesAndStats) {
+    draw_image(0, 0, 0);
+    draw_image(0, 0, 0);
+
+    qp_clear_cache();
+    painter_cache_stats_t cleared = stats();
+    EXPECT_EQ(cleared.hits, 0u);
+    EXPECT_EQ(cleared.misses, 0u);
+    EXPECT_EQ(cleared.evictions, 0u);
+    EXPECT_EQ(cleared.bytes_used, 0u);
+
+    draw_image(0, 0, 0);
+    EXPECT_EQ(stats().misses, 1u);
+    EXPECT_EQ(stats().hits, 0u);
+}
+
+TEST_F(PainterDrawCache, ClosingImageDropsItsFrames) {
+    draw_image(0, 0, 0);
+    ASSERT_GT(qp_drawtext(surface, 0, 12, font, "Q"), 0);
+    uint32_t with_image = stats().bytes_used;
+
+    qp_close_image(image);
+    EXPECT_EQ(stats().bytes_used, with_image - IMAGE_BYTES);
+
+    image = qp_load_image_mem(gfx_test_image);
+    draw_image(0, 0, 0);
+    EXPECT_EQ(stats().misses, 3u);
+}
+
+#else // (QUANTUM_PAINTER_DRAW_CACHE_SIZE) > 0
+
+TEST_F(PainterDrawCache, StatsStayZeroWhenDisabled) {
+    draw_scene();
+    draw_scene();
+    painter_cache_stats_t disabled = stats();
+    EXPECT_EQ(disabled.hits, 0u);
+    EXPECT_EQ(disabled.misses, 0u);
+    EXPECT_EQ(disabled.evictions, 0u);
+    EXPECT_EQ(disabled.bytes_used, 0u);
+}
+
+#endif // (QUANTUM_PAINTER_DRAW_CACHE_SIZE) > 0
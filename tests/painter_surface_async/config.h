@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define SURFACE_NUM_DEVICES 2
+// Small enough for narrow regions to take several chunks
+#define SURFACE_ASYNC_BUFFER_SIZE 32
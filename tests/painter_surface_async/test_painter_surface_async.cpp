@@ -0,0 +1,327 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_comms.h"
+#include "qp_surface_internal.h"
+}
+
+#define PANEL_WIDTH 32
+#define PANEL_HEIGHT 24
+
+/* A fake panel standing in for an SPI display. Its "DMA" only reads the pixel data once the transfer completes, a few
+ * polls of comms_busy after it was started, so anything that changes the data in the meantime shows up on the panel. */
+
+static struct {
+    uint16_t pixels[PANEL_HEIGHT][PANEL_WIDTH];
+    uint16_t l, t, r, b, x, y;
+
+    bool        selected;
+    const void *dma_data;
+    uint32_t    dma_bytes;
+    int         dma_polls;
+
+    int async_transfers;
+    int sync_transfers;
+} panel;
+
+static void panel_write(const void *data, uint32_t byte_count) {
+    const uint16_t *pixels = (const uint16_t *)data;
+    for (uint32_t i = 0; i < byte_count / sizeof(uint16_t); i++) {
+        panel.pixels[panel.y][panel.x] = pixels[i];
+        if (++panel.x > panel.r) {
+            panel.x = panel.l;
+            if (++panel.y > panel.b) {
+                panel.y = panel.t;
+            }
+        }
+    }
+}
+
+static bool fake_comms_init(painter_device_t device) {
+    return true;
+}
+
+static bool fake_comms_start(painter_device_t device) {
+    EXPECT_FALSE(panel.selected) << "panel started twice";
+    panel.selected = true;
+    return true;
+}
+
+static void fake_comms_stop(painter_device_t device) {
+    EXPECT_EQ(panel.dma_data, nullptr) << "panel stopped while a transfer was in flight";
+    panel.selected = false;
+}
+
+static uint32_t fake_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    EXPECT_TRUE(panel.selected);
+    panel_write(data, byte_count);
+    panel.sync_transfers++;
+    return byte_count;
+}
+
+static bool fake_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    EXPECT_TRUE(panel.selected);
+    EXPECT_EQ(panel.dma_data, nullptr);
+    panel.dma_data  = data;
+    panel.dma_bytes = byte_count;
+    panel.dma_polls = 3;
+    panel.async_transfers++;
+    return true;
+}
+
+static bool fake_comms_busy(painter_device_t device) {
+    if (panel.dma_data && --panel.dma_polls == 0) {
+        panel_write(panel.dma_data, panel.dma_bytes);
+        panel.dma_data = nullptr;
+    }
+    return panel.dma_data != nullptr;
+}
+
+static bool fake_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+static bool fake_power(painter_device_t device, bool power_on) {
+    return true;
+}
+
+static bool fake_clear(painter_device_t device) {
+    return true;
+}
+
+static bool fake_flush(painter_device_t device) {
+    return true;
+}
+
+static bool fake_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    EXPECT_TRUE(panel.selected);
+    panel.l = panel.x = left;
+    panel.t = panel.y = top;
+    panel.r           = right;
+    panel.b           = bottom;
+    return true;
+}
+
+static bool fake_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    return qp_comms_send(device, pixel_data, native_pixel_count * sizeof(uint16_t)) == native_pixel_count * sizeof(uint16_t);
+}
+
+static bool fake_pixdata_async(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    return qp_comms_send_async(device, pixel_data, native_pixel_count * sizeof(uint16_t));
+}
+
+static bool fake_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    return true;
+}
+
+static bool fake_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    return true;
+}
+
+static bool fake_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    return true;
+}
+
+static const painter_comms_vtable_t fake_async_comms_vtable = {
+    .comms_init       = fake_comms_init,
+    .comms_start      = fake_comms_start,
+    .comms_stop       = fake_comms_stop,
+    .comms_send       = fake_comms_send,
+    .comms_send_async = fake_comms_send_async,
+    .comms_busy       = fake_comms_busy,
+};
+
+static const painter_comms_vtable_t fake_sync_comms_vtable = {
+    .comms_init  = fake_comms_init,
+    .comms_start = fake_comms_start,
+    .comms_stop  = fake_comms_stop,
+    .comms_send  = fake_comms_send,
+};
+
+static const painter_driver_vtable_t fake_driver_vtable = {
+    .init            = fake_init,
+    .power           = fake_power,
+    .clear           = fake_clear,
+    .flush           = fake_flush,
+    .viewport        = fake_viewport,
+    .pixdata         = fake_pixdata,
+    .pixdata_async   = fake_pixdata_async,
+    .palette_convert = fake_palette_convert,
+    .append_pixels   = fake_append_pixels,
+    .append_pixdata  = fake_append_pixdata,
+};
+
+static painter_driver_t fake_panel_device;
+
+static uint16_t         framebuffer[PANEL_HEIGHT][PANEL_WIDTH];
+static uint8_t          mono_framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 1)];
+static painter_device_t surface;
+static painter_device_t mono_surface;
+
+static struct {
+    int  count;
+    bool success;
+} callbacks;
+
+static void draw_done(painter_device_t surface, painter_device_t target, bool success, void *cb_arg) {
+    callbacks.count++;
+    callbacks.success = success;
+    EXPECT_EQ(cb_arg, &callbacks);
+}
+
+class PainterSurfaceAsync : public TestFixture {
+   protected:
+    void SetUp() override {
+        if (!surface) {
+            surface      = qp_make_rgb565_surface(PANEL_WIDTH, PANEL_HEIGHT, framebuffer);
+            mono_surface = qp_make_mono1bpp_surface(PANEL_WIDTH, PANEL_HEIGHT, mono_framebuffer);
+        }
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+        fake_panel_device = (painter_driver_t){
+            .driver_vtable         = &fake_driver_vtable,
+            .comms_vtable          = &fake_async_comms_vtable,
+            .panel_width           = PANEL_WIDTH,
+            .panel_height          = PANEL_HEIGHT,
+            .native_bits_per_pixel = 16,
+        };
+        ASSERT_TRUE(qp_init(&fake_panel_device, QP_ROTATION_0));
+
+        memset(&panel, 0, sizeof(panel));
+        memset(&callbacks, 0, sizeof(callbacks));
+    }
+
+    void TearDown() override {
+        EXPECT_FALSE(qp_surface_draw_in_progress(surface));
+    }
+
+    // Runs the Quantum Painter task until the draw completes, checking the panel is only selected while a chunk is in flight
+    void run_until_done() {
+        for (int i = 0; i < 10000 && qp_surface_draw_in_progress(surface); i++) {
+            qp_surface_async_task();
+            if (!panel.dma_data) {
+                EXPECT_FALSE(panel.selected) << "bus held with no transfer in flight";
+            }
+        }
+        EXPECT_FALSE(qp_surface_draw_in_progress(surface));
+    }
+
+    void fill(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint16_t rgb565) {
+        uint16_t pixels[PANEL_WIDTH * PANEL_HEIGHT];
+        uint32_t count = (right - left + 1) * (bottom - top + 1);
+        for (uint32_t i = 0; i < count; i++) {
+            pixels[i] = rgb565;
+        }
+        ASSERT_TRUE(qp_viewport(surface, left, top, right, bottom));
+        ASSERT_TRUE(qp_pixdata(surface, pixels, count));
+    }
+
+    void expect_panel_matches(const uint16_t (&expected)[PANEL_HEIGHT][PANEL_WIDTH]) {
+        for (int y = 0; y < PANEL_HEIGHT; y++) {
+            for (int x = 0; x < PANEL_WIDTH; x++) {
+                ASSERT_EQ(panel.pixels[y][x], expected[y][x]) << "at " << x << "," << y;
+            }
+        }
+    }
+};
+
+TEST_F(PainterSurfaceAsync, EntireSurfaceIsSentFromTheFramebuffer) {
+    fill(0, 0, PANEL_WIDTH - 1, PANEL_HEIGHT - 1, 0x1234);
+    fill(3, 4, 20, 10, 0xBEEF);
+
+    ASSERT_TRUE(qp_surface_draw_async(surface, &fake_panel_device, 0, 0, true, draw_done, &callbacks));
+    EXPECT_TRUE(qp_surface_draw_in_progress(surface));
+    EXPECT_EQ(callbacks.count, 0);
+    run_until_done();
+
+    EXPECT_EQ(callbacks.count, 1);
+    EXPECT_TRUE(callbacks.success);
+    EXPECT_EQ(panel.async_transfers, 1);
+    expect_panel_matches(framebuffer);
+}
+
+TEST_F(PainterSurfaceAsync, NarrowRegionIsSentInChunks) {
+    ASSERT_TRUE(qp_surface_draw(surface, &fake_panel_device, 0, 0, true));
+    panel.sync_transfers = 0;
+
+    fill(5, 2, 14, 11, 0x00F0);
+    ASSERT_TRUE(qp_surface_draw_async(surface, &fake_panel_device, 0, 0, false, draw_done, &callbacks));
+    run_until_done();
+
+    EXPECT_EQ(callbacks.count, 1);
+    // 100 pixels through 16 pixel buffers
+    EXPECT_EQ(panel.async_transfers, 7);
+    EXPECT_EQ(panel.sync_transfers, 0);
+    expect_panel_matches(framebuffer);
+}
+
+TEST_F(PainterSurfaceAsync, DrawingToTheSurfaceWaitsForTheTransfer) {
+    fill(0, 0, PANEL_WIDTH - 1, PANEL_HEIGHT - 1, 0x1111);
+    ASSERT_TRUE(qp_surface_draw(surface, &fake_panel_device, 0, 0, true));
+
+    fill(0, 0, PANEL_WIDTH - 1, PANEL_HEIGHT - 1, 0x2222);
+    uint16_t sent[PANEL_HEIGHT][PANEL_WIDTH];
+    memcpy(sent, framebuffer, sizeof(sent));
+
+    ASSERT_TRUE(qp_surface_draw_async(surface, &fake_panel_device, 0, 0, false, draw_done, &callbacks));
+    ASSERT_TRUE(qp_surface_draw_in_progress(surface));
+
+    // Without waiting, the fake DMA would pick up part of this
+    fill(0, 0, PANEL_WIDTH - 1, 5, 0x3333);
+    EXPECT_FALSE(qp_surface_draw_in_progress(surface));
+    EXPECT_EQ(callbacks.count, 1);
+    expect_panel_matches(sent);
+
+    // The new contents follow with the next draw
+    ASSERT_TRUE(qp_surface_draw_async(surface, &fake_panel_device, 0, 0, false, draw_done, &callbacks));
+    run_until_done();
+    EXPECT_EQ(callbacks.count, 2);
+    expect_panel_matches(framebuffer);
+}
+
+TEST_F(PainterSurfaceAsync, SyncDrawWaitsForAsyncDraw) {
+    fill(0, 0, PANEL_WIDTH - 1, PANEL_HEIGHT - 1, 0x4444);
+    ASSERT_TRUE(qp_surface_draw_async(surface, &fake_panel_device, 0, 0, true, draw_done, &callbacks));
+    ASSERT_TRUE(qp_surface_draw(surface, &fake_panel_device, 0, 0, true));
+
+    EXPECT_EQ(callbacks.count, 1);
+    EXPECT_FALSE(qp_surface_draw_in_progress(surface));
+    EXPECT_FALSE(panel.selected);
+    expect_panel_matches(framebuffer);
+}
+
+TEST_F(PainterSurfaceAsync, TargetWithoutAsyncCommsIsSentSynchronously) {
+    fake_panel_device.comms_vtable = &fake_sync_comms_vtable;
+
+    fill(0, 0, PANEL_WIDTH - 1, PANEL_HEIGHT - 1, 0x5555);
+    fill(1, 1, 7, 20, 0x6666);
+    ASSERT_TRUE(qp_surface_draw_async(surface, &fake_panel_device, 0, 0, true, draw_done, &callbacks));
+    run_until_done();
+
+    EXPECT_EQ(callbacks.count, 1);
+    EXPECT_TRUE(callbacks.success);
+    EXPECT_EQ(panel.async_transfers, 0);
+    EXPECT_GT(panel.sync_transfers, 0);
+    expect_panel_matches(framebuffer);
+}
+
+TEST_F(PainterSurfaceAsync, SurfaceWithoutChunksFallsBackToSyncDraw) {
+    fake_panel_device.native_bits_per_pixel = 1;
+    ASSERT_TRUE(qp_init(mono_surface, QP_ROTATION_0));
+
+    // Same result as qp_surface_draw(), which mono surfaces don't support yet, and nothing left in progress
+    bool sync = qp_surface_draw(mono_surface, &fake_panel_device, 0, 0, true);
+    ASSERT_TRUE(qp_init(mono_surface, QP_ROTATION_0));
+    EXPECT_EQ(qp_surface_draw_async(mono_surface, &fake_panel_device, 0, 0, true, draw_done, &callbacks), sync);
+    EXPECT_FALSE(qp_surface_draw_in_progress(mono_surface));
+    EXPECT_EQ(callbacks.count, sync ? 1 : 0);
+    EXPECT_EQ(panel.async_transfers, 0);
+    EXPECT_FALSE(panel.selected);
+}
@@ -0,0 +1,91 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+
+/* With this test's features the dispatch table holds process_record_kb, caps word and space cadet,
+ * which see every key, and magic, grave escape and tri layer, which only see their own keycodes. */
+#define HANDLERS_FOR_EVERY_KEY 3
+
+class ProcessRecordDispatch : public TestFixture {};
+
+TEST_F(ProcessRecordDispatch, BasicKeyOnlyReachesHandlersForEveryKey) {
+    TestDriver driver;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    EXPECT_EQ(get_process_record_handler_count(), HANDLERS_FOR_EVERY_KEY);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    EXPECT_EQ(get_process_record_handler_count(), HANDLERS_FOR_EVERY_KEY);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, FeatureKeycodeReachesItsHandler) {
+    TestDriver driver;
+    KeymapKey  grave_esc = KeymapKey(0, 0, 0, QK_GRAVE_ESCAPE);
+
+    set_keymap({grave_esc});
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    grave_esc.press();
+    run_one_scan_loop();
+    EXPECT_EQ(get_process_record_handler_count(), HANDLERS_FOR_EVERY_KEY + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    grave_esc.release();
+    run_one_scan_loop();
+    EXPECT_EQ(get_process_record_handler_count(), HANDLERS_FOR_EVERY_KEY + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, HandlerConsumingTheEventStopsDispatch) {
+    TestDriver driver;
+    KeymapKey  lower = KeymapKey(0, 0, 0, QK_TRI_LAYER_LOWER);
+
+    set_keymap({lower, KeymapKey(1, 0, 0, KC_TRNS)});
+
+    EXPECT_NO_REPORT(driver);
+    lower.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(get_tri_layer_lower_layer()));
+    // Tri layer is the last handler in the table, so it is reached and consumes the key
+    EXPECT_EQ(get_process_record_handler_count(), HANDLERS_FOR_EVERY_KEY + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    lower.release();
+    run_one_scan_loop();
+    EXPECT_FALSE(layer_state_is(get_tri_layer_lower_layer()));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, CapsWordStillSeesEveryKey) {
+    TestDriver driver;
+    KeymapKey  key_space = KeymapKey(0, 0, 0, KC_SPACE);
+
+    set_keymap({key_space});
+    caps_word_on();
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    key_space.press();
+    run_one_scan_loop();
+    EXPECT_EQ(get_process_record_handler_count(), HANDLERS_FOR_EVERY_KEY);
+    // Space isn't a word character, so caps word must have seen it to turn off
+    EXPECT_FALSE(is_caps_word_on());
+    key_space.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
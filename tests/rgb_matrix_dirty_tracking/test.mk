@@ -0,0 +1,9 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# The IS31FL3733 driver is wired up by the test, over a counting stand-in for the I2C driver
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+
+VPATH += $(DRIVER_PATH)/led/issi
+SRC += $(DRIVER_PATH)/led/issi/is31fl3733.c
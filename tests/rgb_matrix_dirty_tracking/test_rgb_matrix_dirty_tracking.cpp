@@ -0,0 +1,152 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+// The rgb_matrix headers are written for C
+#define _Static_assert static_assert
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "is31fl3733.h"
+#include "i2c_master.h"
+
+void advance_time(uint32_t ms);
+}
+
+/* rgb_matrix draws through the IS31FL3733 driver, wired up as in rgb_matrix_drivers.c, with the calls into the driver
+ * and the PWM transfers on the I2C bus counted. */
+
+static unsigned set_color_calls;
+static unsigned flush_calls;
+static unsigned pwm_transfers;
+static uint8_t  page;
+static uint8_t  pwm[192];
+static RGB      indicator;
+
+static void counting_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    set_color_calls++;
+    is31fl3733_set_color(index, red, green, blue);
+}
+
+static void counting_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        counting_set_color(i, red, green, blue);
+    }
+}
+
+static void counting_flush(void) {
+    flush_calls++;
+    is31fl3733_flush();
+}
+
+extern "C" {
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = is31fl3733_init_drivers,
+    .set_color     = counting_set_color,
+    .set_color_all = counting_set_color_all,
+    .flush         = counting_flush,
+};
+
+// clang-format off
+// Each LED in a transfer of its own
+const is31fl3733_led_t PROGMEM g_is31fl3733_leds[IS31FL3733_LED_COUNT] = {
+    {0, 0x00, 0x01, 0x02},
+    {0, 0x30, 0x31, 0x32},
+    {0, 0x60, 0x61, 0x62},
+    {0, 0x90, 0x91, 0x92},
+};
+// clang-format on
+
+led_config_t g_led_config;
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    if (regaddr == IS31FL3733_REG_COMMAND) {
+        page = data[0];
+    } else if (page == IS31FL3733_COMMAND_PWM && regaddr + length <= sizeof(pwm)) {
+        memcpy(&pwm[regaddr], data, length);
+        // Single register writes are the driver clearing the chip in is31fl3733_init()
+        if (length > 1) {
+            pwm_transfers++;
+        }
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+// LED 1 shows an indicator on top of the effect
+bool rgb_matrix_indicators_user(void) {
+    rgb_matrix_set_color(1, indicator.r, indicator.g, indicator.b);
+    return true;
+}
+}
+
+class RgbMatrixDirtyTracking : public ::testing::Test {
+   protected:
+    static void SetUpTestCase() {
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            g_led_config.flags[i] = LED_FLAG_KEYLIGHT;
+        }
+        rgb_matrix_init();
+    }
+
+    void SetUp() override {
+        indicator = {0, 0, 0};
+        rgb_matrix_sethsv_noeeprom(HSV_RED);
+        frames(4);
+        clear_counts();
+    }
+
+    static void clear_counts() {
+        set_color_calls = 0;
+        flush_calls     = 0;
+        pwm_transfers   = 0;
+    }
+
+    // Runs rgb_matrix_task() for long enough to draw and flush `count` frames
+    static void frames(unsigned count) {
+        for (unsigned i = 0; i < count * RGB_MATRIX_LED_FLUSH_LIMIT; i++) {
+            advance_time(1);
+            rgb_matrix_task();
+        }
+    }
+
+    static void expect_led(uint8_t index, uint8_t red, uint8_t green, uint8_t blue) {
+        is31fl3733_led_t led = g_is31fl3733_leds[index];
+        EXPECT_EQ(pwm[led.r], red) << "LED " << (int)index;
+        EXPECT_EQ(pwm[led.g], green) << "LED " << (int)index;
+        EXPECT_EQ(pwm[led.b], blue) << "LED " << (int)index;
+    }
+};
+
+TEST_F(RgbMatrixDirtyTracking, SteadyFramesSendNothing) {
+    frames(10);
+    EXPECT_EQ(set_color_calls, 0u);
+    EXPECT_EQ(flush_calls, 0u);
+    EXPECT_EQ(pwm_transfers, 0u);
+    expect_led(0, 255, 0, 0);
+    expect_led(1, 0, 0, 0);
+}
+
+TEST_F(RgbMatrixDirtyTracking, IndicatorChangeSendsOnlyItsTransfer) {
+    indicator = {0, 0, 255};
+    frames(10);
+    EXPECT_EQ(set_color_calls, 1u);
+    EXPECT_EQ(flush_calls, 1u);
+    EXPECT_EQ(pwm_transfers, 1u);
+    expect_led(0, 255, 0, 0);
+    expect_led(1, 0, 0, 255);
+}
+
+TEST_F(RgbMatrixDirtyTracking, EffectChangeSendsEveryLed) {
+    rgb_matrix_sethsv_noeeprom(HSV_GREEN);
+    frames(10);
+    // LED 1 keeps showing the indicator
+    EXPECT_EQ(set_color_calls, RGB_MATRIX_LED_COUNT - 1u);
+    EXPECT_EQ(flush_calls, 1u);
+    EXPECT_EQ(pwm_transfers, RGB_MATRIX_LED_COUNT - 1u);
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        if (i != 1) expect_led(i, 0, 255, 0);
+    }
+}
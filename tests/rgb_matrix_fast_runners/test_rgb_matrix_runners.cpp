@@ -0,0 +1,136 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "gtest/gtest.h"
+
+// The rgb_matrix headers are written for C
+#define _Static_assert static_assert
+
+extern "C" {
+#include "rgb_matrix.h"
+}
+
+static RGB leds[RGB_MATRIX_LED_COUNT];
+
+static void leds_init(void) {}
+
+static void leds_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    leds[index] = {r, g, b};
+}
+
+static void leds_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        leds_set_color(i, r, g, b);
+    }
+}
+
+static void leds_flush(void) {}
+
+extern "C" {
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = leds_init,
+    .set_color     = leds_set_color,
+    .set_color_all = leds_set_color_all,
+    .flush         = leds_flush,
+};
+
+led_config_t g_led_config;
+
+#define RGB_MATRIX_EFFECT(name, ...) bool name(effect_params_t *params);
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+}
+
+#ifdef RGB_MATRIX_FAST_RUNNERS
+#    define RUNNERS "fast"
+#else
+#    define RUNNERS "standard"
+#endif
+
+#define FRAMES 64
+
+/* The expected hashes cover FRAMES frames of each effect, and were taken without RGB_MATRIX_FAST_RUNNERS. Both builds
+ * check against them, so the precalculated distances must draw exactly the same LEDs as sqrt16(). */
+static const struct {
+    const char *name;
+    bool (*render)(effect_params_t *params);
+    uint32_t expected;
+} effects[] = {
+    {"BAND_SPIRAL_SAT", BAND_SPIRAL_SAT, 0x75ee0788},
+    {"BAND_SPIRAL_VAL", BAND_SPIRAL_VAL, 0x1ab4ddbe},
+    {"CYCLE_OUT_IN", CYCLE_OUT_IN, 0x0ab09941},
+    {"CYCLE_SPIRAL", CYCLE_SPIRAL, 0x8f403d07},
+};
+
+class RgbMatrixRunners : public ::testing::Test {
+   protected:
+    static void SetUpTestCase() {
+        // A grid of keys, one LED each, spread over the whole 224x64 area
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                uint8_t i                        = row * MATRIX_COLS + col;
+                g_led_config.matrix_co[row][col] = i;
+                g_led_config.point[i]            = {(uint8_t)(col * 224 / (MATRIX_COLS - 1)), (uint8_t)(row * 64 / (MATRIX_ROWS - 1))};
+                g_led_config.flags[i]            = LED_FLAG_KEYLIGHT;
+            }
+        }
+        rgb_matrix_init();
+    }
+
+    void SetUp() override {
+        rgb_matrix_config.hsv   = {0, 255, 255};
+        rgb_matrix_config.speed = 128;
+        memset(leds, 0, sizeof(leds));
+    }
+
+    // Draws one frame the way rgb_matrix_task() does, one rgb_matrix_get_limits() chunk per call
+    static void render(bool (*effect)(effect_params_t *params), uint32_t frame) {
+        g_rgb_timer = frame * 397;
+
+        effect_params_t params = {0, LED_FLAG_ALL, frame == 0};
+        bool            more;
+        do {
+            more = effect(&params);
+            params.iter++;
+        } while (more);
+    }
+
+    // FNV-1a, carried on from frame to frame
+    static uint32_t hash_leds(uint32_t hash) {
+        const uint8_t *bytes = (const uint8_t *)leds;
+        for (size_t i = 0; i < sizeof(leds); i++) {
+            hash = (hash ^ bytes[i]) * 16777619u;
+        }
+        return hash;
+    }
+};
+
+TEST_F(RgbMatrixRunners, EffectsMatchWithoutFastRunners) {
+    for (const auto &effect : effects) {
+        uint32_t hash = 2166136261u;
+        for (uint32_t frame = 0; frame < FRAMES; frame++) {
+            render(effect.render, frame);
+            hash = hash_leds(hash);
+        }
+        EXPECT_EQ(hash, effect.expected) << effect.name << " drew 0x" << std::hex << hash;
+    }
+}
+
+TEST_F(RgbMatrixRunners, Benchmark) {
+    using clock = std::chrono::steady_clock;
+
+    for (const auto &effect : effects) {
+        const unsigned frames = 2000;
+
+        auto start = clock::now();
+        for (uint32_t frame = 0; frame < frames; frame++) {
+            render(effect.render, frame);
+        }
+        std::chrono::nanoseconds total = clock::now() - start;
+
+        printf("[ BENCH    ] %-8s %-26s %8.1f ns/frame\n", RUNNERS, effect.name, (double)total.count() / frames);
+    }
+}
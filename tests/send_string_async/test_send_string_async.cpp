@@ -0,0 +1,174 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "send_string.h"
+#include "timer.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::Invoke;
+
+// Mods followed by the six keys of a keyboard report
+using Report = std::vector<uint8_t>;
+
+// Covers shifted characters, tapped, held and released keycodes, and a delay
+static const char *const macro = "Hello, World! 123" SS_TAP(X_ENTER) SS_DOWN(X_LCTL) "c" SS_UP(X_LCTL) SS_DELAY(20) "~done";
+
+class SendStringAsync : public TestFixture {
+   protected:
+    std::vector<Report> reports;
+
+    void record_reports(TestDriver &driver) {
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([this](report_keyboard_t &report) {
+            Report r{report.mods};
+            r.insert(r.end(), report.keys, report.keys + KEYBOARD_REPORT_KEYS);
+            reports.push_back(r);
+        }));
+    }
+
+    // Runs the keyboard until the queue is empty, returning the longest time a single pass took
+    uint32_t run_until_sent(unsigned max_loops = 10000) {
+        uint32_t longest_loop = 0;
+        for (unsigned i = 0; i < max_loops && send_string_async_in_progress(); i++) {
+            uint32_t start = timer_read32();
+            run_one_scan_loop();
+            longest_loop = std::max(longest_loop, timer_read32() - start);
+        }
+        return longest_loop;
+    }
+};
+
+TEST_F(SendStringAsync, TypesTheSameReportsAsBlockingSend) {
+    TestDriver driver;
+    record_reports(driver);
+
+    send_string_with_delay(macro, 0);
+    std::vector<Report> blocking = reports;
+    reports.clear();
+
+    EXPECT_TRUE(send_string_with_delay_async(macro, 0, nullptr, nullptr));
+    EXPECT_TRUE(send_string_async_in_progress());
+    run_until_sent();
+    EXPECT_FALSE(send_string_async_in_progress());
+
+    EXPECT_FALSE(blocking.empty());
+    EXPECT_EQ(reports, blocking);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, KeepsScanningWhileTyping) {
+    TestDriver driver;
+    KeymapKey  key_f1(0, 0, 0, KC_F1);
+    set_keymap({key_f1});
+    record_reports(driver);
+
+    EXPECT_TRUE(send_string_with_delay_async("a long string typed slowly", 10, nullptr, nullptr));
+    idle_for(50);
+
+    // The key press is reported straight away, while the string is still being typed
+    key_f1.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(send_string_async_in_progress());
+    ASSERT_FALSE(reports.empty());
+    EXPECT_NE(std::find(reports.back().begin() + 1, reports.back().end(), KC_F1), reports.back().end());
+    key_f1.release();
+    run_one_scan_loop();
+
+    run_until_sent();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, DelaysDoNotBlockTheKeyboard) {
+    TestDriver driver;
+    record_reports(driver);
+
+    EXPECT_TRUE(send_string_with_delay_async("a" SS_DELAY(100) "b", 0, nullptr, nullptr));
+    uint32_t start        = timer_read32();
+    uint32_t longest_loop = run_until_sent();
+
+    EXPECT_EQ(longest_loop, 1u);
+    EXPECT_GE(timer_read32() - start, 100u);
+    EXPECT_EQ(reports.size(), 4u);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, CallbacksRunInOrderWhenEachStringIsDone) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    std::vector<int> completed;
+    auto             callback = [](void *cb_arg) { static_cast<std::vector<int> *>(cb_arg)->push_back(static_cast<int>(static_cast<std::vector<int> *>(cb_arg)->size())); };
+
+    for (int i = 0; i < SEND_STRING_ASYNC_QUEUE_SIZE; i++) {
+        EXPECT_TRUE(send_string_async("abc", callback, &completed));
+    }
+    // The queue is full
+    EXPECT_FALSE(send_string_async("abc", callback, &completed));
+
+    run_one_scan_loop();
+    EXPECT_TRUE(completed.empty());
+
+    run_until_sent();
+    EXPECT_EQ(completed, std::vector<int>({0, 1, 2, 3}));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, CancelLeavesNoKeyHeld) {
+    TestDriver driver;
+    record_reports(driver);
+
+    bool called   = false;
+    auto callback = [](void *cb_arg) { *static_cast<bool *>(cb_arg) = true; };
+    EXPECT_TRUE(send_string_with_delay_async("ABC", 10, callback, &called));
+
+    // Shift goes down first, then the rest of the character waits for the interval
+    run_one_scan_loop();
+    ASSERT_FALSE(reports.empty());
+    EXPECT_EQ(reports.back()[0], MOD_BIT(KC_LEFT_SHIFT));
+
+    send_string_async_cancel();
+    EXPECT_FALSE(send_string_async_in_progress());
+    EXPECT_EQ(reports.back(), Report(1 + KEYBOARD_REPORT_KEYS, 0));
+
+    idle_for(100);
+    EXPECT_FALSE(called);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, LongestLoopBenchmark) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    std::string text;
+    while (text.size() < 200) {
+        text += "The quick brown fox jumps over the lazy dog. ";
+    }
+    text.resize(200);
+
+    // Time passes inside wait_ms() here, so a blocking send holds up the keyboard for its whole duration
+    uint32_t start = timer_read32();
+    send_string_with_delay(text.c_str(), 5);
+    uint32_t blocking_ms = timer_read32() - start;
+
+    EXPECT_TRUE(send_string_with_delay_async(text.c_str(), 5, nullptr, nullptr));
+    start                 = timer_read32();
+    uint32_t longest_loop = run_until_sent(100000);
+    uint32_t async_ms     = timer_read32() - start;
+
+    EXPECT_EQ(longest_loop, 1u);
+    printf("[ BENCH    ] 200 characters: blocking send stalls the keyboard for %u ms, async send takes %u ms with the longest loop %u ms\n", blocking_ms, async_ms, longest_loop);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define SOURCE_LAYERS_CACHE_COMPACT
+/* The test keymaps are set up at runtime, so keymaps[] only has a single layer */
+#define SOURCE_LAYERS_CACHE_LAYERS 4
@@ -0,0 +1,12 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define SOURCE_LAYERS_CACHE_COMPACT
+/* The test keymaps are set up at runtime, so keymaps[] only has a single layer */
+#define SOURCE_LAYERS_CACHE_LAYERS 4
+/* As generated from info.json, see matrix_key_index in the test */
+#define MATRIX_KEY_COUNT 2
@@ -0,0 +1,50 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+/* Stands in for the generated one, as if the layouts only used (0,0) and (0,1). Every other position shares the
+ * entry after those. */
+extern "C" const uint8_t matrix_key_index[MATRIX_ROWS][MATRIX_COLS] PROGMEM = {
+    {0, 1, 2, 2, 2, 2, 2, 2, 2, 2},
+    {2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+    {2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+    {2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+};
+
+class SourceLayersCacheSparse : public TestFixture {};
+
+TEST_F(SourceLayersCacheSparse, MappedPositionsHaveTheirOwnEntry) {
+    const keypos_t first = {.col = 0, .row = 0}, second = {.col = 1, .row = 0};
+
+    update_source_layers_cache(first, 3);
+    update_source_layers_cache(second, 1);
+    EXPECT_EQ(read_source_layers_cache(first), 3);
+    EXPECT_EQ(read_source_layers_cache(second), 1);
+}
+
+TEST_F(SourceLayersCacheSparse, UnmappedPositionReleasesOnLayerFromPress) {
+    TestDriver driver;
+    KeymapKey  key = KeymapKey{0, 5, 2, KC_A};
+
+    set_keymap({key, KeymapKey{3, 5, 2, KC_B}});
+
+    layer_on(3);
+
+    EXPECT_REPORT(driver, (KC_B));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The layer was stored in the shared entry, rather than looked up again on release
+    layer_off(3);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,62 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class SourceLayersCache : public TestFixture {};
+
+TEST_F(SourceLayersCache, ReleaseUsesLayerFromPress) {
+    TestDriver driver;
+    KeymapKey  key = KeymapKey{0, 0, 0, KC_A};
+
+    set_keymap({key, KeymapKey{3, 0, 0, KC_B}});
+
+    layer_on(3);
+
+    EXPECT_REPORT(driver, (KC_B));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    layer_off(3);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SourceLayersCache, PackedEntriesDoNotOverlap) {
+    TestDriver driver;
+
+    /* Consecutive entries share storage bytes, so give every key of a row a
+     * different source layer and check that each one reads back its own. */
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        const uint8_t source_layer = col % 4;
+        for (uint8_t layer = 0; layer < 4; layer++) {
+            add_key(KeymapKey(layer, col, 1, layer == source_layer ? (uint16_t)(KC_A + col) : (layer > source_layer ? KC_TRNS : KC_NO)));
+        }
+    }
+
+    layer_on(1);
+    layer_on(2);
+    layer_on(3);
+
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        const keypos_t key = {.col = col, .row = 1};
+        EXPECT_EQ(layer_switch_get_layer(key), col % 4);
+        update_source_layers_cache(key, layer_switch_get_layer(key));
+    }
+
+    layer_clear();
+
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        const keypos_t key = {.col = col, .row = 1};
+        EXPECT_EQ(read_source_layers_cache(key), col % 4);
+    }
+    VERIFY_AND_CLEAR(driver);
+}
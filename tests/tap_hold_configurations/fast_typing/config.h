@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// A common choice with home row mods, and the longer the tapping term the more events wait on it
+#define TAPPING_TERM 300
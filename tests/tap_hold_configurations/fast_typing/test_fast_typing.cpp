@@ -0,0 +1,171 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::Invoke;
+
+// Every uppercase word is typed while holding the right shift home row mod on 'j'
+static const char *const trace = "the quick brown fox jumps over the lazy dog while QMK sends USB HID reports as fast as flashing OLED boards allow so all keys roll";
+
+// How long a key is held, typical of home row mod typists
+static const unsigned dwell_ms = 90;
+
+struct TraceEvent {
+    uint32_t time;
+    size_t   key;
+    bool     pressed;
+};
+
+struct TypedKey {
+    uint8_t keycode;
+    bool    shifted;
+
+    bool operator==(const TypedKey &other) const {
+        return keycode == other.keycode && shifted == other.shifted;
+    }
+};
+
+static std::ostream &operator<<(std::ostream &os, const TypedKey &key) {
+    return os << get_keycode_identifier_or_default(key.keycode) << (key.shifted ? "(shifted)" : "");
+}
+
+class FastTyping : public TestFixture, public ::testing::WithParamInterface<unsigned> {
+   protected:
+    std::vector<KeymapKey> keys;
+    std::string            key_chars;
+
+    void SetUp() override {
+        // clang-format off
+        const char    *rows[]       = {"asdfghjkl;", "qwertyuiop", "zxcvbnm,./"};
+        const uint16_t home_row[]   = {LGUI_T(KC_A), LALT_T(KC_S), LCTL_T(KC_D), LSFT_T(KC_F), KC_G, KC_H, RSFT_T(KC_J), RCTL_T(KC_K), RALT_T(KC_L), RGUI_T(KC_SCLN)};
+        const uint16_t top_row[]    = {KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y, KC_U, KC_I, KC_O, KC_P};
+        const uint16_t bottom_row[] = {KC_Z, KC_X, KC_C, KC_V, KC_B, KC_N, KC_M, KC_COMM, KC_DOT, KC_SLSH};
+        // clang-format on
+        const uint16_t *keycodes[] = {home_row, top_row, bottom_row};
+
+        for (uint8_t row = 0; row < 3; row++) {
+            for (uint8_t col = 0; col < 10; col++) {
+                uint16_t keycode = keycodes[row][col];
+                keys.push_back(KeymapKey(0, col, row, keycode, QK_MOD_TAP_GET_TAP_KEYCODE(keycode)));
+                key_chars.push_back(rows[row][col]);
+            }
+        }
+        keys.push_back(KeymapKey(0, 0, 3, KC_SPACE));
+        key_chars.push_back(' ');
+
+        for (const auto &key : keys) {
+            add_key(key);
+        }
+    }
+
+    size_t key_index(char c) {
+        return key_chars.find(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c);
+    }
+
+    // Lays the trace out at the given speed, five characters to a word, each key held for dwell_ms
+    std::vector<TraceEvent> build_events(unsigned wpm, std::vector<TypedKey> &expected) {
+        const uint32_t          interval = 60000 / (wpm * 5);
+        const size_t            shift    = key_index('j');
+        std::vector<TraceEvent> events;
+        std::vector<uint32_t>   released(keys.size(), 0);
+        uint32_t                time = 0;
+
+        auto type = [&](size_t key) {
+            // A key can't be pressed again before it is let go
+            time = std::max(time, released[key] + 10);
+            events.push_back({time, key, true});
+            events.push_back({time + dwell_ms, key, false});
+            released[key] = time + dwell_ms;
+            time += interval;
+        };
+
+        for (const char *c = trace; *c;) {
+            if (*c >= 'A' && *c <= 'Z') {
+                uint32_t shift_pressed = std::max(time, released[shift] + 10);
+                events.push_back({shift_pressed, shift, true});
+                time = shift_pressed + interval / 2;
+                for (; *c >= 'A' && *c <= 'Z'; c++) {
+                    size_t key = key_index(*c);
+                    type(key);
+                    expected.push_back({(uint8_t)QK_MOD_TAP_GET_TAP_KEYCODE(keys[key].code), true});
+                }
+                // Held past the tapping term so that it always resolves as shift
+                released[shift] = std::max(shift_pressed + TAPPING_TERM + 20, time - interval + dwell_ms + 10);
+                events.push_back({released[shift], shift, false});
+                time = std::max(time, released[shift] + 10);
+            } else {
+                size_t key = key_index(*c++);
+                type(key);
+                expected.push_back({(uint8_t)QK_MOD_TAP_GET_TAP_KEYCODE(keys[key].code), false});
+            }
+        }
+
+        std::stable_sort(events.begin(), events.end(), [](const TraceEvent &a, const TraceEvent &b) { return a.time < b.time; });
+        return events;
+    }
+};
+
+TEST_P(FastTyping, NoEventIsDropped) {
+    TestDriver            driver;
+    std::vector<TypedKey> expected;
+    std::vector<TypedKey> typed;
+    std::vector<uint8_t>  held;
+    unsigned              wrong_mods = 0;
+
+    // Records every key that is newly pressed in a report, and whether shift was down at the time
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+        std::vector<uint8_t> now;
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+            if (report.keys[i] == KC_NO) continue;
+            now.push_back(report.keys[i]);
+            if (std::find(held.begin(), held.end(), report.keys[i]) == held.end()) {
+                typed.push_back({report.keys[i], (report.mods & MOD_BIT(KC_RIGHT_SHIFT)) != 0});
+            }
+        }
+        if (report.mods & ~MOD_BIT(KC_RIGHT_SHIFT)) {
+            wrong_mods++;
+        }
+        held = now;
+    }));
+
+    std::vector<TraceEvent> events = build_events(GetParam(), expected);
+    uint32_t                now    = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (const auto &event : events) {
+        if (event.time > now) {
+            idle_for(event.time - now);
+            now = event.time;
+        }
+        if (event.pressed) {
+            keys[event.key].press();
+        } else {
+            keys[event.key].release();
+        }
+    }
+    idle_for(TAPPING_TERM + 1);
+    now += TAPPING_TERM + 1;
+    double ns_per_scan = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / now;
+
+    EXPECT_EQ(wrong_mods, 0u);
+    EXPECT_TRUE(held.empty());
+    EXPECT_EQ(typed, expected);
+    VERIFY_AND_CLEAR(driver);
+
+    printf("[ BENCH    ] %3u WPM %4zu events, waiting buffer of %u: %7.1f ns/scan\n", GetParam(), events.size(), WAITING_BUFFER_SIZE, ns_per_scan);
+}
+
+INSTANTIATE_TEST_CASE_P(Speeds, FastTyping, ::testing::Values(150, 200, 250, 300), [](const ::testing::TestParamInfo<unsigned> &info) { return std::to_string(info.param) + "Wpm"; });
@@ -0,0 +1,74 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+using testing::_;
+
+extern "C" {
+#include "task_profiler.h"
+}
+
+class TaskProfiler : public TestFixture {
+   protected:
+    void SetUp() override {
+        task_profiler_reset();
+    }
+};
+
+TEST_F(TaskProfiler, EveryScanIsTimed) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    for (int i = 0; i < 10; i++) {
+        run_one_scan_loop();
+    }
+
+    EXPECT_EQ(task_profiler_get_stats(TASK_PROFILER_MATRIX)->count, 10);
+    EXPECT_EQ(task_profiler_get_stats(TASK_PROFILER_QUANTUM)->count, 10);
+    EXPECT_EQ(task_profiler_get_stats(TASK_PROFILER_LED)->count, 10);
+    // The loop is measured between scans, so the first scan has nothing to compare against
+    EXPECT_GE(task_profiler_get_stats(TASK_PROFILER_LOOP)->count, 9);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TaskProfiler, SummaryFollowsSamples) {
+    for (uint32_t us = 1; us <= 100; us++) {
+        task_profiler_add_sample(TASK_PROFILER_QUANTUM, us);
+    }
+    task_profiler_add_sample(TASK_PROFILER_QUANTUM, 5000);
+
+    const task_profiler_stats_t *stats = task_profiler_get_stats(TASK_PROFILER_QUANTUM);
+    EXPECT_EQ(stats->count, 101);
+    EXPECT_EQ(stats->min_us, 1);
+    EXPECT_EQ(stats->max_us, 5000);
+    EXPECT_EQ(task_profiler_get_avg_us(TASK_PROFILER_QUANTUM), (5050 + 5000) / 101);
+
+    // 100 of the 101 samples are at most 100us, which falls in the 64-127us bucket
+    EXPECT_EQ(task_profiler_get_percentile_us(TASK_PROFILER_QUANTUM, 99), 127);
+    EXPECT_EQ(task_profiler_get_percentile_us(TASK_PROFILER_QUANTUM, 100), 5000);
+    EXPECT_EQ(task_profiler_get_percentile_us(TASK_PROFILER_QUANTUM, 50), 63);
+}
+
+TEST_F(TaskProfiler, PercentileIsCappedAtMax) {
+    task_profiler_add_sample(TASK_PROFILER_QUANTUM, 70);
+    EXPECT_EQ(task_profiler_get_percentile_us(TASK_PROFILER_QUANTUM, 99), 70);
+}
+
+TEST_F(TaskProfiler, RawHidReport) {
+    uint8_t data[32] = {0};
+
+    task_profiler_add_sample(TASK_PROFILER_QUANTUM, 10);
+    task_profiler_add_sample(TASK_PROFILER_QUANTUM, 300);
+
+    EXPECT_EQ(task_profiler_raw_hid_report(TASK_PROFILER_QUANTUM, data, 20), 0);
+    ASSERT_EQ(task_profiler_raw_hid_report(TASK_PROFILER_QUANTUM, data, sizeof(data)), 21);
+
+    auto u32 = [&](int offset) { return (uint32_t)data[offset] | (uint32_t)data[offset + 1] << 8 | (uint32_t)data[offset + 2] << 16 | (uint32_t)data[offset + 3] << 24; };
+    EXPECT_EQ(data[0], TASK_PROFILER_QUANTUM);
+    EXPECT_EQ(u32(1), 2);
+    EXPECT_EQ(u32(5), 10);
+    EXPECT_EQ(u32(9), 155);
+    EXPECT_EQ(u32(13), 300);
+    EXPECT_EQ(u32(17), 300);
+}
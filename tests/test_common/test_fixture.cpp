@@ -100,6 +100,9 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+    layer_lookup_cache_clear();
+#endif
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
@@ -70,6 +70,11 @@ ifeq ($(strip $(USB_WAIT_FOR_ENUMERATION)), yes)
     OPT_DEFS += -DUSB_WAIT_FOR_ENUMERATION
 endif
 
+ifeq ($(strip $(USB_REPORT_QUEUE_ENABLE)), yes)
+    OPT_DEFS += -DUSB_REPORT_QUEUE_ENABLE
+    SRC += $(PROTOCOL_DIR)/report_queue.c
+endif
+
 ifeq ($(strip $(JOYSTICK_SHARED_EP)), yes)
     OPT_DEFS += -DJOYSTICK_SHARED_EP
     SHARED_EP_ENABLE = yes
@@ -92,6 +92,15 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+// There is no DMA to hand the transfer to, so it completes before returning
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    return spi_transmit(data, length);
+}
+
+bool spi_busy(void) {
+    return false;
+}
+
 void spi_stop(void) {
     if (currentSelectPin != NO_PIN) {
         gpio_set_pin_output(currentSelectPin);
@@ -78,6 +78,64 @@ static void obnotify(io_buffers_queue_t *bqp) {
 /* Driver exported functions.                                                */
 /*===========================================================================*/
 
+#if defined(USB_REPORT_QUEUE_ENABLE)
+/* Starts sending the oldest queued report, straight from the queue, if the
+ * endpoint is idle. Must be called with the system locked. */
+static void usb_endpoint_in_start_queued_I(usb_endpoint_in_t *endpoint) {
+    if (endpoint->queued_report_in_flight != NULL) {
+        return;
+    }
+
+    if ((usbGetDriverStateI(endpoint->config.usbp) != USB_ACTIVE) || usbGetTransmitStatusI(endpoint->config.usbp, endpoint->config.ep)) {
+        return;
+    }
+
+    uint8_t        length;
+    const uint8_t *report = report_queue_peek(endpoint->report_queue, &length);
+    if (report != NULL) {
+        endpoint->queued_report_in_flight = report;
+        endpoint->queued_report_length    = length;
+        usbStartTransmitI(endpoint->config.usbp, endpoint->config.ep, report, length);
+    }
+}
+
+/* Drops the queued reports, including one being sent. Must be called with
+ * the system locked. */
+static void usb_endpoint_in_clear_queued_I(usb_endpoint_in_t *endpoint) {
+    if (endpoint->report_queue != NULL) {
+        report_queue_clear(endpoint->report_queue);
+        endpoint->queued_report_in_flight = NULL;
+    }
+}
+
+/* Queues a report without waiting for the endpoint, only waiting for the
+ * interrupt to make room if the queue is full. */
+static bool usb_endpoint_in_send_queued(usb_endpoint_in_t *endpoint, const uint8_t *data, size_t size, sysinterval_t timeout) {
+    report_queue_t *queue = endpoint->report_queue;
+
+    if (!report_queue_push(queue, data, size)) {
+        queue->overflows++;
+
+        systime_t start = osalOsGetSystemTimeX();
+        while (!report_queue_push(queue, data, size)) {
+            if (timeout != TIME_INFINITE && osalTimeDiffX(start, osalOsGetSystemTimeX()) >= timeout) {
+                osalSysLock();
+                endpoint->timed_out = true;
+                endpoint->queued_reports_dropped++;
+                osalSysUnlock();
+                return false;
+            }
+            osalThreadSleepMilliseconds(1);
+        }
+    }
+
+    osalSysLock();
+    usb_endpoint_in_start_queued_I(endpoint);
+    osalSysUnlock();
+    return true;
+}
+#endif
+
 void usb_endpoint_in_init(usb_endpoint_in_t *endpoint) {
     usb_endpoint_config_t *config = &endpoint->config;
     endpoint->ep_config.in_state  = &endpoint->ep_in_state;
@@ -124,6 +182,9 @@ void usb_endpoint_in_stop(usb_endpoint_in_t *endpoint) {
 
     bqSuspendI(&endpoint->obqueue);
     obqResetI(&endpoint->obqueue);
+#if defined(USB_REPORT_QUEUE_ENABLE)
+    usb_endpoint_in_clear_queued_I(endpoint);
+#endif
     if (endpoint->report_storage != NULL) {
         endpoint->report_storage->reset_report(endpoint->report_storage->reports);
     }
@@ -146,6 +207,9 @@ void usb_endpoint_out_stop(usb_endpoint_out_t *endpoint) {
 void usb_endpoint_in_suspend_cb(usb_endpoint_in_t *endpoint) {
     bqSuspendI(&endpoint->obqueue);
     obqResetI(&endpoint->obqueue);
+#if defined(USB_REPORT_QUEUE_ENABLE)
+    usb_endpoint_in_clear_queued_I(endpoint);
+#endif
 
     if (endpoint->report_storage != NULL) {
         endpoint->report_storage->reset_report(endpoint->report_storage->reports);
@@ -169,6 +233,9 @@ void usb_endpoint_in_configure_cb(usb_endpoint_in_t *endpoint) {
     usbInitEndpointI(endpoint->config.usbp, endpoint->config.ep, &endpoint->ep_config);
     obqResetI(&endpoint->obqueue);
     bqResumeX(&endpoint->obqueue);
+#if defined(USB_REPORT_QUEUE_ENABLE)
+    usb_endpoint_in_clear_queued_I(endpoint);
+#endif
 }
 
 void usb_endpoint_out_configure_cb(usb_endpoint_out_t *endpoint) {
@@ -197,6 +264,21 @@ void usb_endpoint_in_tx_complete_cb(USBDriver *usbp, usbep_t ep) {
     /* Sending succeded, so we can reset the timed out state. */
     endpoint->timed_out = false;
 
+#if defined(USB_REPORT_QUEUE_ENABLE)
+    if (endpoint->report_queue != NULL) {
+        if (endpoint->queued_report_in_flight != NULL) {
+            if (endpoint->report_storage != NULL) {
+                endpoint->report_storage->set_report(endpoint->report_storage->reports, endpoint->queued_report_in_flight, endpoint->queued_report_length);
+            }
+            endpoint->queued_report_in_flight = NULL;
+            report_queue_pop(endpoint->report_queue);
+        }
+        usb_endpoint_in_start_queued_I(endpoint);
+        osalSysUnlockFromISR();
+        return;
+    }
+#endif
+
     /* Freeing the buffer just transmitted, if it was not a zero size packet.*/
     if (!obqIsEmptyI(&endpoint->obqueue) && usbp->epc[ep]->in_state->txsize > 0U) {
         /* Store the last send report in the endpoint to be retrieved by a
@@ -269,6 +351,12 @@ bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size
     }
     osalSysUnlock();
 
+#if defined(USB_REPORT_QUEUE_ENABLE)
+    if (endpoint->report_queue != NULL && !buffered) {
+        return usb_endpoint_in_send_queued(endpoint, data, size, timeout);
+    }
+#endif
+
     while (true) {
         size_t sent = obqWriteTimeout(&endpoint->obqueue, data, size, timeout);
 
@@ -315,6 +403,11 @@ bool usb_endpoint_in_is_inactive(usb_endpoint_in_t *endpoint) {
 
     osalSysLock();
     bool inactive = obqIsEmptyI(&endpoint->obqueue) && !usbGetTransmitStatusI(endpoint->config.usbp, endpoint->config.ep);
+#if defined(USB_REPORT_QUEUE_ENABLE)
+    if (endpoint->report_queue != NULL) {
+        inactive = inactive && report_queue_is_empty(endpoint->report_queue);
+    }
+#endif
     osalSysUnlock();
 
     return inactive;
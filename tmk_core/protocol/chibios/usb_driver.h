@@ -10,6 +10,7 @@
 #include "usb_descriptor.h"
 #include "chibios_config.h"
 #include "usb_report_handling.h"
+#include "report_queue.h"
 #include "string.h"
 #include "timer.h"
 
@@ -166,6 +167,13 @@ typedef struct {
     usbreqhandler_t       usb_requests_cb;
     bool                  timed_out;
     usb_report_storage_t *report_storage;
+#if defined(USB_REPORT_QUEUE_ENABLE)
+    /* Reports are sent straight from this queue rather than through obqueue, when set. */
+    report_queue_t *report_queue;
+    const uint8_t  *queued_report_in_flight;
+    size_t          queued_report_length;
+    uint16_t        queued_reports_dropped;
+#endif
 } usb_endpoint_in_t;
 
 typedef struct {
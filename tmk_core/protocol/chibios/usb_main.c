@@ -340,7 +340,65 @@ static const USBConfig usbcfg = {
 #endif
 };
 
+#if defined(USB_REPORT_QUEUE_ENABLE)
+#    if !defined(USB_REPORT_QUEUE_CAPACITY)
+#        define USB_REPORT_QUEUE_CAPACITY 16
+#    endif
+
+_Static_assert((USB_REPORT_QUEUE_CAPACITY & (USB_REPORT_QUEUE_CAPACITY - 1)) == 0 && USB_REPORT_QUEUE_CAPACITY <= 128, "USB_REPORT_QUEUE_CAPACITY must be a power of two, up to 128");
+
+#    define USB_REPORT_QUEUE_ATTACH(_endpoint, _report_size, _coalesce, _latest_only)                                   \
+        do {                                                                                                            \
+            static report_queue_t queue;                                                                                \
+            static uint8_t        storage[REPORT_QUEUE_STORAGE_SIZE(_report_size, USB_REPORT_QUEUE_CAPACITY)];          \
+            report_queue_init(&queue, storage, _report_size, USB_REPORT_QUEUE_CAPACITY, _coalesce, _latest_only);       \
+            usb_endpoints_in[_endpoint].report_queue = &queue;                                                          \
+        } while (0)
+
+/* Reports on the HID endpoints are queued, so that a burst of them, e.g. from
+ * a macro, doesn't hold up the main loop while the host polls for each one.
+ * Repeats are only dropped on endpoints carrying absolute state: mouse reports
+ * are relative, and the shared endpoint can carry them. Joystick and digitizer
+ * reports also only need the latest one queued to reach the host. */
+static void usb_report_queues_init(void) {
+#    if !defined(KEYBOARD_SHARED_EP)
+    USB_REPORT_QUEUE_ATTACH(USB_ENDPOINT_IN_KEYBOARD, KEYBOARD_EPSIZE, true, false);
+#    endif
+#    if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
+    USB_REPORT_QUEUE_ATTACH(USB_ENDPOINT_IN_MOUSE, MOUSE_EPSIZE, false, false);
+#    endif
+#    if defined(SHARED_EP_ENABLE)
+    USB_REPORT_QUEUE_ATTACH(USB_ENDPOINT_IN_SHARED, SHARED_EPSIZE, false, false);
+#    endif
+#    if defined(JOYSTICK_ENABLE) && !defined(JOYSTICK_SHARED_EP)
+    USB_REPORT_QUEUE_ATTACH(USB_ENDPOINT_IN_JOYSTICK, JOYSTICK_EPSIZE, true, true);
+#    endif
+#    if defined(DIGITIZER_ENABLE) && !defined(DIGITIZER_SHARED_EP)
+    USB_REPORT_QUEUE_ATTACH(USB_ENDPOINT_IN_DIGITIZER, DIGITIZER_EPSIZE, true, true);
+#    endif
+}
+
+/* Keyboard reports are all queued, so the host has received them once their queues have drained. */
+bool host_keyboard_ready(void) {
+#    if !defined(KEYBOARD_SHARED_EP)
+    if (!report_queue_is_empty(usb_endpoints_in[USB_ENDPOINT_IN_KEYBOARD].report_queue)) {
+        return false;
+    }
+#    endif
+#    if defined(SHARED_EP_ENABLE)
+    if (!report_queue_is_empty(usb_endpoints_in[USB_ENDPOINT_IN_SHARED].report_queue)) {
+        return false;
+    }
+#    endif
+    return true;
+}
+#endif
+
 void init_usb_driver(USBDriver *usbp) {
+#if defined(USB_REPORT_QUEUE_ENABLE)
+    usb_report_queues_init();
+#endif
+
     for (int i = 0; i < USB_ENDPOINT_IN_COUNT; i++) {
         usb_endpoint_in_init(&usb_endpoints_in[i]);
         usb_endpoint_in_start(&usb_endpoints_in[i]);
@@ -249,6 +249,11 @@ void host_programmable_button_send(uint32_t data) {
 
 __attribute__((weak)) void send_programmable_button(report_programmable_button_t *report) {}
 
+/* Drivers that queue reports override this, sending a report otherwise waits for the host */
+__attribute__((weak)) bool host_keyboard_ready(void) {
+    return true;
+}
+
 uint16_t host_last_system_usage(void) {
     return last_system_usage;
 }
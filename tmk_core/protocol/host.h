@@ -44,6 +44,9 @@ void    host_system_send(uint16_t usage);
 void    host_consumer_send(uint16_t usage);
 void    host_programmable_button_send(uint32_t data);
 
+/* whether the host has received every keyboard report sent so far, so that another can be sent without waiting */
+bool host_keyboard_ready(void);
+
 uint16_t host_last_system_usage(void);
 uint16_t host_last_consumer_usage(void);
 
@@ -32,24 +32,27 @@ static int8_t cb_tail  = 0;
 static int8_t cb_count = 0;
 #endif
 
+#define KEY_BITMAP_BYTES 32
+
+// Every key held, whichever protocol is in use. The keys of the report are only touched when a key
+// actually goes down or up, and the report in use is rebuilt from it when the protocol changes.
+static uint8_t key_bitmap[KEY_BITMAP_BYTES];
+static uint8_t key_count    = 0;
+static bool    keys_changed = false;
+#ifdef NKRO_ENABLE
+static bool keys_in_nkro = false;
+#endif
+
+static inline bool key_bitmap_get(uint8_t code) {
+    return key_bitmap[code >> 3] & (1 << (code & 7));
+}
+
 /** \brief has_anykey
  *
  * FIXME: Needs doc
  */
 uint8_t has_anykey(void) {
-    uint8_t  cnt = 0;
-    uint8_t* p   = keyboard_report->keys;
-    uint8_t  lp  = sizeof(keyboard_report->keys);
-#ifdef NKRO_ENABLE
-    if (keyboard_protocol && keymap_config.nkro) {
-        p  = nkro_report->bits;
-        lp = sizeof(nkro_report->bits);
-    }
-#endif
-    while (lp--) {
-        if (*p++) cnt++;
-    }
-    return cnt;
+    return key_count;
 }
 
 /** \brief get_first_key
@@ -90,13 +93,13 @@ bool is_key_pressed(uint8_t key) {
     }
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
-        if ((key >> 3) < NKRO_REPORT_BITS) {
-            return nkro_report->bits[key >> 3] & 1 << (key & 7);
-        } else {
-            return false;
-        }
+        return (key >> 3) < NKRO_REPORT_BITS && key_bitmap_get(key);
     }
 #endif
+    // A key pressed while the report was full can be held without being in it
+    if (!key_bitmap_get(key)) {
+        return false;
+    }
     for (int i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
         if (keyboard_report->keys[i] == key) {
             return true;
@@ -237,11 +240,58 @@ void del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
 }
 #endif
 
+/** \brief Writes the held keys to the report of the protocol in use
+ *
+ * Keys only go into the report in use, so when the host or the user switches protocol the other
+ * report is rebuilt from the key bitmap.
+ */
+static void sync_report_protocol(void) {
+#ifdef NKRO_ENABLE
+    bool nkro = keyboard_protocol && keymap_config.nkro;
+    if (nkro == keys_in_nkro) {
+        return;
+    }
+    keys_in_nkro = nkro;
+    keys_changed = true;
+
+    if (nkro) {
+        memset(nkro_report->bits, 0, sizeof(nkro_report->bits));
+        memcpy(nkro_report->bits, key_bitmap, MIN(sizeof(nkro_report->bits), sizeof(key_bitmap)));
+        return;
+    }
+
+    memset(keyboard_report->keys, 0, sizeof(keyboard_report->keys));
+#    ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
+    cb_head = cb_tail = cb_count = 0;
+#    endif
+    for (uint16_t code = 0; code < KEY_BITMAP_BYTES * 8; code++) {
+        if (key_bitmap_get(code)) {
+            add_key_byte(keyboard_report, code);
+        }
+    }
+#endif
+}
+
+bool report_keys_changed(void) {
+    sync_report_protocol();
+    bool changed = keys_changed;
+    keys_changed = false;
+    return changed;
+}
+
 /** \brief add key to report
  *
- * FIXME: Needs doc
+ * Does nothing if the key is already held, otherwise sets it in the key bitmap and the report in use.
  */
 void add_key_to_report(uint8_t key) {
+    sync_report_protocol();
+    if (key_bitmap_get(key)) {
+        return;
+    }
+    key_bitmap[key >> 3] |= 1 << (key & 7);
+    key_count++;
+    keys_changed = true;
+
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
         add_key_bit(nkro_report, key);
@@ -253,9 +303,17 @@ void add_key_to_report(uint8_t key) {
 
 /** \brief del key from report
  *
- * FIXME: Needs doc
+ * Does nothing if the key isn't held, otherwise clears it from the key bitmap and the report in use.
  */
 void del_key_from_report(uint8_t key) {
+    sync_report_protocol();
+    if (!key_bitmap_get(key)) {
+        return;
+    }
+    key_bitmap[key >> 3] &= ~(1 << (key & 7));
+    key_count--;
+    keys_changed = true;
+
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
         del_key_bit(nkro_report, key);
@@ -267,10 +325,17 @@ void del_key_from_report(uint8_t key) {
 
 /** \brief clear key from report
  *
- * FIXME: Needs doc
+ * Releases every key, leaving the mods alone.
  */
 void clear_keys_from_report(void) {
-    // not clear mods
+    sync_report_protocol();
+    if (key_count == 0) {
+        return;
+    }
+    memset(key_bitmap, 0, sizeof(key_bitmap));
+    key_count    = 0;
+    keys_changed = true;
+
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
         memset(nkro_report->bits, 0, sizeof(nkro_report->bits));
@@ -278,6 +343,9 @@ void clear_keys_from_report(void) {
     }
 #endif
     memset(keyboard_report->keys, 0, sizeof(keyboard_report->keys));
+#ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
+    cb_head = cb_tail = cb_count = 0;
+#endif
 }
 
 #ifdef MOUSE_ENABLE
@@ -335,6 +335,8 @@ void del_key_bit(report_nkro_t* nkro_report, uint8_t code);
 void add_key_to_report(uint8_t key);
 void del_key_from_report(uint8_t key);
 void clear_keys_from_report(void);
+// Returns whether keys went down or up since the last call, catching the report in use up with a protocol change first
+bool report_keys_changed(void);
 
 #ifdef MOUSE_ENABLE
 bool has_mouse_report_changed(report_mouse_t* new_report, report_mouse_t* old_report);
@@ -0,0 +1,92 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "report_queue.h"
+
+#define REPORT_QUEUE_SUPERSEDED 0x01
+
+static inline uint8_t *report_queue_slot(const report_queue_t *queue, uint8_t index) {
+    return &queue->storage[(index & (queue->capacity - 1)) * (queue->report_size + REPORT_QUEUE_SLOT_HEADER)];
+}
+
+void report_queue_init(report_queue_t *queue, uint8_t *storage, uint8_t report_size, uint8_t capacity, bool coalesce, bool latest_only) {
+    memset(queue, 0, sizeof(report_queue_t));
+    queue->storage     = storage;
+    queue->report_size = report_size;
+    queue->capacity    = capacity;
+    queue->coalesce    = coalesce;
+    queue->latest_only = latest_only;
+}
+
+bool report_queue_push(report_queue_t *queue, const void *report, uint8_t length) {
+    uint8_t tail   = queue->tail;
+    uint8_t queued = tail - __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+
+    if (length > queue->report_size) {
+        length = queue->report_size;
+    }
+
+    if (queue->coalesce && queued > 0) {
+        // The consumer never writes a slot, so the newest one can be read even while it is being sent
+        const uint8_t *newest = report_queue_slot(queue, tail - 1);
+        if (newest[0] == length && memcmp(&newest[REPORT_QUEUE_SLOT_HEADER], report, length) == 0) {
+            queue->coalesced++;
+            return true;
+        }
+    }
+
+    if (queued >= queue->capacity) {
+        return false;
+    }
+
+    uint8_t *slot = report_queue_slot(queue, tail);
+    slot[0]       = length;
+    slot[1]       = 0;
+    memcpy(&slot[REPORT_QUEUE_SLOT_HEADER], report, length);
+
+    if (queue->latest_only && queued > 0) {
+        // Flagged before this report is published, so the consumer only skips the older one once it
+        // can see the newer one. If the older one is already on its way, the flag is never looked at.
+        __atomic_store_n(&report_queue_slot(queue, tail - 1)[1], REPORT_QUEUE_SUPERSEDED, __ATOMIC_RELAXED);
+    }
+
+    __atomic_store_n(&queue->tail, (uint8_t)(tail + 1), __ATOMIC_RELEASE);
+    return true;
+}
+
+const uint8_t *report_queue_peek(report_queue_t *queue, uint8_t *length) {
+    uint8_t head = queue->head;
+    uint8_t tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+
+    while (head != tail) {
+        uint8_t *slot = report_queue_slot(queue, head);
+
+        if ((uint8_t)(tail - head) > 1 && (__atomic_load_n(&slot[1], __ATOMIC_RELAXED) & REPORT_QUEUE_SUPERSEDED)) {
+            head++;
+            queue->superseded++;
+            __atomic_store_n(&queue->head, head, __ATOMIC_RELEASE);
+            continue;
+        }
+
+        *length = slot[0];
+        return &slot[REPORT_QUEUE_SLOT_HEADER];
+    }
+
+    return NULL;
+}
+
+void report_queue_pop(report_queue_t *queue) {
+    if (queue->head != __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE)) {
+        __atomic_store_n(&queue->head, (uint8_t)(queue->head + 1), __ATOMIC_RELEASE);
+    }
+}
+
+void report_queue_clear(report_queue_t *queue) {
+    __atomic_store_n(&queue->head, __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+}
+
+bool report_queue_is_empty(const report_queue_t *queue) {
+    return __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE) == __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+}
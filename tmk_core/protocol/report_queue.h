@@ -0,0 +1,61 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* A single-producer/single-consumer queue of HID reports, for handing reports from the main loop to
+ * whatever sends them on to the host, e.g. a USB interrupt. Neither side takes a lock: the producer
+ * only ever writes `tail` and the consumer only ever writes `head`.
+ *
+ * Each slot is [length] [flags] [report...]. On a coalescing queue, a report identical to the newest
+ * queued one is dropped, as sending it would not change anything on the host. That only holds for
+ * reports of absolute state, such as a keyboard or joystick: mouse reports are relative, so a repeat
+ * moves the cursor again. On a latest-only queue, a report also supersedes the one before it, which
+ * the consumer then skips.
+ */
+
+#define REPORT_QUEUE_SLOT_HEADER 2
+#define REPORT_QUEUE_STORAGE_SIZE(report_size, capacity) ((capacity) * ((report_size) + REPORT_QUEUE_SLOT_HEADER))
+
+typedef struct report_queue_t {
+    uint8_t *storage;
+    uint8_t  report_size;
+    uint8_t  capacity; // a power of two, up to 128
+    bool     coalesce;
+    bool     latest_only;
+    uint8_t  head; // written by the consumer
+    uint8_t  tail; // written by the producer
+    // Written by the producer
+    uint16_t coalesced;
+    uint16_t overflows;
+    // Written by the consumer
+    uint16_t superseded;
+} report_queue_t;
+
+void report_queue_init(report_queue_t *queue, uint8_t *storage, uint8_t report_size, uint8_t capacity, bool coalesce, bool latest_only);
+
+/**
+ * @brief Queues a report, from the producer.
+ *
+ * Returns false if the queue is full, leaving it to the caller to wait or give up. On a coalescing
+ * queue, a report that coalesces with the newest queued one counts as queued.
+ */
+bool report_queue_push(report_queue_t *queue, const void *report, uint8_t length);
+
+/**
+ * @brief Returns the oldest report still to be sent, from the consumer, or NULL if there is none.
+ *
+ * The report stays valid, and in the queue, until report_queue_pop().
+ */
+const uint8_t *report_queue_peek(report_queue_t *queue, uint8_t *length);
+
+// Removes the report returned by report_queue_peek(), from the consumer
+void report_queue_pop(report_queue_t *queue);
+
+// Drops every queued report, from the consumer
+void report_queue_clear(report_queue_t *queue);
+
+bool report_queue_is_empty(const report_queue_t *queue);
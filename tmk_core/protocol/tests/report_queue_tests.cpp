@@ -0,0 +1,169 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "report_queue.h"
+}
+
+static const uint8_t report_size = 8;
+static const uint8_t capacity    = 4;
+
+class ReportQueue : public ::testing::Test {
+   protected:
+    uint8_t        storage[REPORT_QUEUE_STORAGE_SIZE(report_size, capacity)];
+    report_queue_t queue;
+
+    void SetUp() override {
+        report_queue_init(&queue, storage, report_size, capacity, true, false);
+    }
+
+    bool push(uint8_t key) {
+        uint8_t report[report_size] = {0, 0, key};
+        return report_queue_push(&queue, report, sizeof(report));
+    }
+
+    // Returns the key of the oldest report, or 0xFF if there is none
+    uint8_t pop() {
+        uint8_t        length;
+        const uint8_t *report = report_queue_peek(&queue, &length);
+        if (report == NULL) return 0xFF;
+        EXPECT_EQ(length, report_size);
+        uint8_t key = report[2];
+        report_queue_pop(&queue);
+        return key;
+    }
+};
+
+TEST_F(ReportQueue, ReportsComeOutInOrder) {
+    EXPECT_TRUE(report_queue_is_empty(&queue));
+    EXPECT_TRUE(push(0x04));
+    EXPECT_TRUE(push(0x00));
+    EXPECT_TRUE(push(0x05));
+    EXPECT_FALSE(report_queue_is_empty(&queue));
+
+    EXPECT_EQ(pop(), 0x04);
+    EXPECT_EQ(pop(), 0x00);
+    EXPECT_EQ(pop(), 0x05);
+    EXPECT_EQ(pop(), 0xFF);
+    EXPECT_TRUE(report_queue_is_empty(&queue));
+}
+
+TEST_F(ReportQueue, RepeatedReportIsCoalesced) {
+    EXPECT_TRUE(push(0x04));
+    EXPECT_TRUE(push(0x04));
+    EXPECT_TRUE(push(0x00));
+    EXPECT_TRUE(push(0x00));
+    EXPECT_EQ(queue.coalesced, 2);
+
+    EXPECT_EQ(pop(), 0x04);
+    EXPECT_EQ(pop(), 0x00);
+    EXPECT_EQ(pop(), 0xFF);
+}
+
+TEST_F(ReportQueue, RepeatedReportIsKeptWithoutCoalescing) {
+    // Relative reports, e.g. mouse movement, have to reach the host as many times as they were sent
+    report_queue_init(&queue, storage, report_size, capacity, false, false);
+
+    EXPECT_TRUE(push(0x04));
+    EXPECT_TRUE(push(0x04));
+    EXPECT_EQ(queue.coalesced, 0);
+
+    EXPECT_EQ(pop(), 0x04);
+    EXPECT_EQ(pop(), 0x04);
+    EXPECT_EQ(pop(), 0xFF);
+}
+
+TEST_F(ReportQueue, FullQueueRefusesReports) {
+    for (uint8_t i = 0; i < capacity; i++) {
+        EXPECT_TRUE(push(0x04 + i));
+    }
+    EXPECT_FALSE(push(0x10));
+    // A repeat of the newest report still needs no room
+    EXPECT_TRUE(push(0x04 + capacity - 1));
+
+    EXPECT_EQ(pop(), 0x04);
+    EXPECT_TRUE(push(0x10));
+    for (uint8_t i = 1; i < capacity; i++) {
+        EXPECT_EQ(pop(), 0x04 + i);
+    }
+    EXPECT_EQ(pop(), 0x10);
+}
+
+TEST_F(ReportQueue, LatestOnlySkipsSupersededReports) {
+    report_queue_init(&queue, storage, report_size, capacity, true, true);
+
+    EXPECT_TRUE(push(0x01));
+    EXPECT_TRUE(push(0x02));
+    EXPECT_TRUE(push(0x03));
+    EXPECT_EQ(pop(), 0x03);
+    EXPECT_EQ(queue.superseded, 2);
+    EXPECT_TRUE(report_queue_is_empty(&queue));
+}
+
+TEST_F(ReportQueue, ReportBeingSentIsNotSkipped) {
+    report_queue_init(&queue, storage, report_size, capacity, true, true);
+
+    uint8_t length;
+    EXPECT_TRUE(push(0x01));
+    const uint8_t *in_flight = report_queue_peek(&queue, &length);
+    ASSERT_NE(in_flight, nullptr);
+
+    // Superseded while it is being sent: the consumer pops it rather than peeking again
+    EXPECT_TRUE(push(0x02));
+    EXPECT_EQ(in_flight[2], 0x01);
+    report_queue_pop(&queue);
+    EXPECT_EQ(pop(), 0x02);
+}
+
+TEST_F(ReportQueue, ClearDropsEverything) {
+    EXPECT_TRUE(push(0x04));
+    EXPECT_TRUE(push(0x05));
+    report_queue_clear(&queue);
+    EXPECT_TRUE(report_queue_is_empty(&queue));
+    EXPECT_EQ(pop(), 0xFF);
+}
+
+TEST_F(ReportQueue, ProducerAndConsumerOnSeparateThreads) {
+    /* The producer stands in for the main loop and the consumer for the USB interrupt. Every report
+     * differs from the one before it, so all of them have to arrive, in order. */
+    const unsigned        reports = 20000;
+    std::atomic<unsigned> received{0};
+    bool                  in_order = true;
+
+    std::thread consumer([&] {
+        uint16_t expected = 0;
+        while (received < reports) {
+            uint8_t        length;
+            const uint8_t *report = report_queue_peek(&queue, &length);
+            if (report == NULL) {
+                std::this_thread::yield();
+                continue;
+            }
+            uint16_t value;
+            memcpy(&value, report, sizeof(value));
+            in_order = in_order && value == expected;
+            expected++;
+            report_queue_pop(&queue);
+            received++;
+        }
+    });
+
+    for (unsigned i = 0; i < reports; i++) {
+        uint8_t  report[report_size] = {0};
+        uint16_t value               = i;
+        memcpy(report, &value, sizeof(value));
+        while (!report_queue_push(&queue, report, sizeof(report))) {
+            std::this_thread::yield();
+        }
+    }
+
+    consumer.join();
+    EXPECT_TRUE(in_order);
+    EXPECT_EQ(received, reports);
+    EXPECT_EQ(queue.coalesced, 0);
+}